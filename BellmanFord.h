@@ -4,7 +4,10 @@
 #include <vector>
 #include <limits>
 #include <iostream>
+#include <iomanip>
 #include "graph/IGraph.h"
+#include "graph/IWeightedGraph.h"
+#include "utils/ResultWriter.h"
 
 /**
  * @struct BellmanFordResult
@@ -25,53 +28,101 @@ struct BellmanFordResult {
 /**
  * @brief Implementa o algoritmo de Bellman-Ford.
  * @param graph O grafo onde o algoritmo será aplicado.
- * @param weights A matriz de pesos das arestas do grafo.
  * @param start O nó inicial para o cálculo das distâncias.
+ * @param for_each_edge Função que recebe uma função de visita e a chama com a origem, o destino
+ * e o peso de cada aresta. Se a visita retornar false, o percurso das arestas deve ser interrompido.
  * @return O resultado do algoritmo contendo distâncias, predecessores e indicação de ciclo negativo.
  */
-template<typename Node>
-BellmanFordResult bellman_ford(const IGraph<Node>& graph, 
-    const std::vector<std::vector<double>>& weights, const Node& start) {
+template<typename Node, class ForEachEdge>
+BellmanFordResult bellman_ford_visit(const IGraph<Node>& graph, const Node& start, ForEachEdge for_each_edge) {
 
     BellmanFordResult result(graph.get_order());
 
     //Inicializa a distância do nó inicial para ele mesmo como 0
     int start_index = graph.get_index(start);
     result.distances[start_index] = 0;
-    //Obtém todas as arestas do grafo
-    auto edges = graph.get_all_edges();
 
-    for(size_t i = 0; i < graph.get_order() - 1; ++i) {
-        //Para cada aresta, verifica se é possível melhorar a distância
-        for(const EdgeIndex& edge : edges) {
-            int u = edge.from;
-            int v = edge.to;
-            double weight = weights[u][v];
+    for(size_t i = 0; i + 1 < graph.get_order(); ++i) {
+        bool changed = false;
 
+        //Para cada aresta, verifica se é possível melhorar a distância
+        for_each_edge([&](int u, int v, double weight) {
             if(result.distances[u] + weight < result.distances[v]) {
                 result.distances[v] = result.distances[u] + weight;
                 result.predecessors[v] = u;
+                changed = true;
             }
+            return true;
+        });
+
+        //Se nenhuma distância mudou nesta rodada, as próximas também não mudariam
+        if(!changed) {
+            break;
         }
     }
 
     // Verifica a presença de ciclos negativos.
-    for(const EdgeIndex& edge : edges) {
-        int u = edge.from;
-        int v = edge.to;
-        double weight = weights[u][v];
-
+    for_each_edge([&](int u, int v, double weight) {
         if(result.distances[u] + weight < result.distances[v]) {
             result.has_negative_cycle = true;
-            break;
+            return false;
         }
-    }
+        return true;
+    });
 
     return result;
 }
 
+/**
+ * @brief Implementa o algoritmo de Bellman-Ford.
+ * @param graph O grafo onde o algoritmo será aplicado.
+ * @param weights A matriz de pesos das arestas do grafo.
+ * @param start O nó inicial para o cálculo das distâncias.
+ * @return O resultado do algoritmo contendo distâncias, predecessores e indicação de ciclo negativo.
+ */
+template<typename Node>
+BellmanFordResult bellman_ford(const IGraph<Node>& graph, 
+    const std::vector<std::vector<double>>& weights, const Node& start) {
+
+    //Obtém todas as arestas do grafo
+    auto edges = graph.get_all_edges();
+
+    return bellman_ford_visit(graph, start, [&](auto visit) {
+        for(const EdgeIndex& edge : edges) {
+            if(!visit(edge.from, edge.to, weights[edge.from][edge.to])) {
+                return;
+            }
+        }
+    });
+}
+
+/**
+ * @brief Implementa o algoritmo de Bellman-Ford em um grafo que armazena os pesos junto às arestas.
+ *
+ * As arestas são percorridas diretamente nas listas de vizinhos, sem criar uma lista de arestas.
+ * Em grafos não-direcionados, cada aresta é relaxada nos dois sentidos.
+ * @param graph O grafo ponderado onde o algoritmo será aplicado.
+ * @param start O nó inicial para o cálculo das distâncias.
+ * @return O resultado do algoritmo contendo distâncias, predecessores e indicação de ciclo negativo.
+ */
+template<typename Node>
+BellmanFordResult bellman_ford(const IWeightedGraph<Node>& graph, const Node& start) {
+    return bellman_ford_visit(graph, start, [&](auto visit) {
+        for(size_t u = 0; u < graph.get_order(); ++u) {
+            bool completed = graph.for_each_weighted_neighbor(u, [&](int v, double weight) {
+                return visit(static_cast<int>(u), v, weight);
+            });
+            if(!completed) {
+                return;
+            }
+        }
+    });
+}
+
 /**
  * @brief Imprime o resultado do algoritmo de Bellman-Ford.
+ *
+ * Para grafos maiores que PRETTY_PRINT_MAX_ORDER, exporte o resultado com write_shortest_paths.
  * @param result O resultado do algoritmo.
  * @param graph O grafo onde o algoritmo foi aplicado.
  */
@@ -79,7 +130,7 @@ template<typename Node>
 void print_bellman_ford_result(const BellmanFordResult& result, const IGraph<Node>& graph) {
     if(result.has_negative_cycle) {
         std::cout << "Graph contains a negative weight cycle.\n";
-    } else {
+    } else if (!skip_pretty_print("Shortest distances from the start node", graph.get_order())) {
 
         std::cout << "Shortest distances from the start node:\n";
 
@@ -6,6 +6,7 @@
 #include <iostream>
 #include <limits>
 #include "graph/IGraph.h"
+#include "graph/IWeightedGraph.h"
 #include "graph/UndirectedAdjacencyListGraph.h"
 
 /**
@@ -65,11 +66,11 @@ DivideBlocksResult divide_blocks(IGraph<Node>& tree) {
                 result.block_index[current] = curr_block;
 
                 // Todos os vizinhos do nó sem bloco determinado são adicionados na fila
-                for (size_t neighbor : tree.get_neighbors_indices(current)) {
+                tree.for_each_neighbor(current, [&](int neighbor) {
                     if (result.block_index[neighbor] == -1) {
                         queue.push(neighbor);
                     }
-                }
+                });
             }
 
             // Adiciona o bloco atual na lista de blocos
@@ -83,11 +84,13 @@ DivideBlocksResult divide_blocks(IGraph<Node>& tree) {
 /**
  * @brief Implementa o algoritmo de Boruvka.
  * @param graph O grafo onde o algoritmo será aplicado.
- * @param weights A matriz de pesos das arestas do grafo.
+ * @param for_each_weighted Função que, dado o índice de um nó e uma função de visita, chama a
+ * visita com o índice e o peso de cada aresta que sai do nó.
+ * @param weight_of Função que retorna o peso da aresta entre dois índices.
  * @return O resultado do algoritmo contendo a árvore geradora mínima e o seu peso total.
  */
-template<typename Node>
-BoruvkaResult<Node> boruvka(IGraph<Node>& graph, const std::vector<std::vector<double>>& weights) {
+template<typename Node, class ForEachWeighted, class WeightOf>
+BoruvkaResult<Node> boruvka_visit(const IGraph<Node>& graph, ForEachWeighted for_each_weighted, WeightOf weight_of) {
     BoruvkaResult<Node> result;
 
     // Adiciona todos os nós do grafo na árvore
@@ -119,18 +122,18 @@ BoruvkaResult<Node> boruvka(IGraph<Node>& graph, const std::vector<std::vector<d
 
             // Percorre todas as arestas do bloco
             for (int node : block) {
-                for (int neighbor : graph.get_neighbors_indices(node)) {
+                for_each_weighted(node, [&](int neighbor, double weight) {
                     // Caso a aresta vá para um nó que não pertence a esse bloco
                     if (divided_blocks.block_index[node] != divided_blocks.block_index[neighbor]) {
                         // Caso a aresta tenha um peso menor que o menor peso encontrado até então
-                        if (weights[node][neighbor] < min_weight) {
+                        if (weight < min_weight) {
                             // Redefine a aresta escolhida
                             chosen_edge.from = node;
                             chosen_edge.to = neighbor;
-                            min_weight = weights[node][neighbor];
+                            min_weight = weight;
                         }
                     }
-                }
+                });
             }
 
             // Adiciona a aresta na lista de arestas escolhidas
@@ -148,10 +151,45 @@ BoruvkaResult<Node> boruvka(IGraph<Node>& graph, const std::vector<std::vector<d
 
     // Calcula o peso total somando o peso de todas as arestas da árvore
     for (auto& edge : result.tree.get_all_edges()) {
-        result.total_weight += weights[edge.from][edge.to];
+        result.total_weight += weight_of(edge.from, edge.to);
     }
 
     return result;
 }
 
+/**
+ * @brief Implementa o algoritmo de Boruvka usando a matriz de pesos das arestas.
+ * @param graph O grafo onde o algoritmo será aplicado.
+ * @param weights A matriz de pesos das arestas do grafo.
+ * @return O resultado do algoritmo contendo a árvore geradora mínima e o seu peso total.
+ */
+template<typename Node>
+BoruvkaResult<Node> boruvka(IGraph<Node>& graph, const std::vector<std::vector<double>>& weights) {
+    auto for_each_weighted = [&](int node, auto visit) {
+        graph.for_each_neighbor(node, [&](int neighbor) {
+            visit(neighbor, weights[node][neighbor]);
+        });
+    };
+    auto weight_of = [&](int from, int to) {
+        return weights[from][to];
+    };
+    return boruvka_visit(graph, for_each_weighted, weight_of);
+}
+
+/**
+ * @brief Implementa o algoritmo de Boruvka em um grafo que armazena os pesos junto às arestas.
+ * @param graph O grafo ponderado onde o algoritmo será aplicado.
+ * @return O resultado do algoritmo contendo a árvore geradora mínima e o seu peso total.
+ */
+template<typename Node>
+BoruvkaResult<Node> boruvka(const IWeightedGraph<Node>& graph) {
+    auto for_each_weighted = [&](int node, auto visit) {
+        graph.for_each_weighted_neighbor(node, visit);
+    };
+    auto weight_of = [&](int from, int to) {
+        return graph.get_weight(from, to);
+    };
+    return boruvka_visit(graph, for_each_weighted, weight_of);
+}
+
 #endif
@@ -2,9 +2,13 @@
 #define DJIKSTRA_H
 
 #include <vector>
+#include <queue>
+#include <utility>
+#include <functional>
 #include <iostream>
 #include <limits>
 #include "graph/IGraph.h"
+#include "graph/IWeightedGraph.h"
 
 /**
  * @struct DjikstraResult
@@ -67,10 +71,10 @@ DjikstraResult djikstra(const IGraph<Node>& graph,
 
     // Para todos os vizinhos do nó inicial, inicializa a distância como sendo o peso da aresta
     // e o predecessor como sendo o nó inicial
-    for (int neighbor : graph.get_neighbors_indices(start_index)) {
+    graph.for_each_neighbor(start_index, [&](int neighbor) {
         result.distances[neighbor] = weights[start_index][neighbor];
         result.predecessors[neighbor] = start_index;
-    }
+    });
 
     // Guarda o nó que está sendo visitado no momento
     int current;
@@ -81,7 +85,7 @@ DjikstraResult djikstra(const IGraph<Node>& graph,
         visited[current] = 1;
 
         // Para todos os vizinhos não-visitados do nó atual
-        for (int neighbor : graph.get_neighbors_indices(current)) {
+        graph.for_each_neighbor(current, [&](int neighbor) {
             if (!visited[neighbor]) {
                 // Distância do nó inicial até o vizinho passando pelo nó atual
                 double distance = result.distances[current] + weights[current][neighbor];
@@ -93,7 +97,57 @@ DjikstraResult djikstra(const IGraph<Node>& graph,
                     result.predecessors[neighbor] = current;
                 }
             }
+        });
+    }
+
+    return result;
+}
+
+/**
+ * @brief Implementa o algoritmo de Djikstra em um grafo que armazena os pesos junto às arestas.
+ *
+ * Como os grafos ponderados costumam ser esparsos, o nó não-visitado de menor distância é
+ * obtido com uma fila de prioridade em vez de uma busca linear, de modo que o algoritmo
+ * executa em O((V + E) log V) e não precisa da matriz de pesos.
+ * @param graph O grafo ponderado onde o algoritmo será aplicado.
+ * @param start O nó inicial para o cálculo das distâncias.
+ * @return O resultado do algoritmo contendo distâncias e predecessores.
+ */
+template<typename Node>
+DjikstraResult djikstra(const IWeightedGraph<Node>& graph, const Node& start) {
+
+    DjikstraResult result(graph.get_order());
+    // Vetor que indica se o nó da posição i foi visitado ou não
+    std::vector<bool> visited(graph.get_order(), false);
+
+    // Fila de prioridade com pares (distância, nó), ordenada pela menor distância
+    using QueueEntry = std::pair<double, int>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+    int start_index = graph.get_index(start);
+    result.distances[start_index] = 0;
+    queue.push({0, start_index});
+
+    while (!queue.empty()) {
+        double distance = queue.top().first;
+        int current = queue.top().second;
+        queue.pop();
+
+        // Entradas antigas de nós já visitados são descartadas
+        if (visited[current]) {
+            continue;
         }
+        visited[current] = true;
+
+        // Para todos os vizinhos não-visitados do nó atual
+        graph.for_each_weighted_neighbor(current, [&](int neighbor, double weight) {
+            if (!visited[neighbor] && result.distances[neighbor] > distance + weight) {
+                // Atualiza a distância e o predecessor do vizinho e o coloca na fila
+                result.distances[neighbor] = distance + weight;
+                result.predecessors[neighbor] = current;
+                queue.push({result.distances[neighbor], neighbor});
+            }
+        });
     }
 
     return result;
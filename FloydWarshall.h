@@ -7,7 +7,9 @@
 #include <algorithm>
 #include <iomanip>
 #include "graph/IGraph.h"
+#include "graph/IWeightedGraph.h"
 #include "graph/DirectedAdjacencyListGraph.h"
+#include "utils/ResultWriter.h"
 
 /**
  * @struct FloydWarshallResult
@@ -26,6 +28,43 @@ struct FloydWarshallResult
     }
 };
 
+/**
+ * @brief Executa a etapa principal do algoritmo de Floyd-Warshall sobre matrizes já inicializadas.
+ *
+ * Também constrói as árvores de caminhos mais curtos de cada nó.
+ * @param graph O grafo onde o algoritmo será aplicado.
+ * @param result O resultado com as matrizes de distâncias e predecessores inicializadas pelas arestas.
+ */
+template <typename Node>
+void floyd_warshall_relax(const IGraph<Node> &graph, FloydWarshallResult<Node> &result)
+{
+    // Para cada nó intermediário k verifica se o caminho passando por k é mais curto
+    // em todos os pares de nós (i, j)
+    for (size_t k = 0; k < graph.get_order(); ++k)
+    {
+        for (size_t i = 0; i < graph.get_order(); ++i)
+        {
+            for (size_t j = 0; j < graph.get_order(); ++j)
+            {
+                // Verifica se o caminho passando por k é mais curto
+                if (result.distances[i][k] + result.distances[k][j] < result.distances[i][j])
+                {
+                    // Atualiza a distância e o predecessor se um caminho mais curto for encontrado
+                    result.distances[i][j] = result.distances[i][k] + result.distances[k][j];
+                    result.predecessors[i][j] = result.predecessors[k][j];
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < graph.get_order(); ++i)
+    {
+        Node source_node = graph.get_node(i);
+        DirectedAdjacencyListGraph<Node> tree = get_shortest_paths_tree(graph, source_node, result.predecessors, result.distances);
+        result.shortest_paths_trees.push_back(tree);
+    }
+}
+
 /**
  * @brief Implementa o algoritmo de Floyd-Warshall.
  * @param graph O grafo onde o algoritmo será aplicado.
@@ -70,33 +109,39 @@ FloydWarshallResult<Node> floyd_warshall(const IGraph<Node> &graph,
     }
 
     // Executa o algoritmo de Floyd-Warshall
+    floyd_warshall_relax(graph, result);
 
-    // Para cada nó intermediário k verifica se o caminho passando por k é mais curto
-    // em todos os pares de nós (i, j)
-    for (size_t k = 0; k < graph.get_order(); ++k)
-    {
-        for (size_t i = 0; i < graph.get_order(); ++i)
-        {
-            for (size_t j = 0; j < graph.get_order(); ++j)
-            {
-                // Verifica se o caminho passando por k é mais curto
-                if (result.distances[i][k] + result.distances[k][j] < result.distances[i][j])
-                {
-                    // Atualiza a distância e o predecessor se um caminho mais curto for encontrado
-                    result.distances[i][j] = result.distances[i][k] + result.distances[k][j];
-                    result.predecessors[i][j] = result.predecessors[k][j];
-                }
-            }
-        }
-    }
+    return result;
+}
+
+/**
+ * @brief Implementa o algoritmo de Floyd-Warshall em um grafo que armazena os pesos junto às arestas.
+ *
+ * As matrizes de distâncias e predecessores são inicializadas percorrendo apenas as arestas
+ * existentes, sem a necessidade de uma matriz de pesos de entrada.
+ * @param graph O grafo ponderado onde o algoritmo será aplicado.
+ * @return O resultado do algoritmo contendo a matriz de distâncias e predecessores.
+ */
+template <typename Node>
+FloydWarshallResult<Node> floyd_warshall(const IWeightedGraph<Node> &graph)
+{
+    FloydWarshallResult<Node> result(graph.get_order());
 
+    // Inicializa as matrizes com as arestas: o predecessor de j é i quando há uma aresta de i para j
     for (size_t i = 0; i < graph.get_order(); ++i)
     {
-        Node source_node = graph.get_node(i);
-        DirectedAdjacencyListGraph<Node> tree = get_shortest_paths_tree(graph, source_node, result.predecessors, result.distances);
-        result.shortest_paths_trees.push_back(tree);
+        graph.for_each_weighted_neighbor(i, [&](int j, double weight) {
+            result.distances[i][j] = weight;
+            result.predecessors[i][j] = static_cast<int>(i);
+        });
+        // O próprio nó é considerado seu predecessor, com distância zero
+        result.distances[i][i] = 0;
+        result.predecessors[i][i] = static_cast<int>(i);
     }
 
+    // Executa o algoritmo de Floyd-Warshall
+    floyd_warshall_relax(graph, result);
+
     return result;
 }
 
@@ -221,6 +266,10 @@ template <typename Node>
 void print_floyd_warshall_result(const FloydWarshallResult<Node> &result, const IGraph<Node> &graph)
 {
     // Implementação da função de impressão do resultado do Floyd-Warshall
+    // Para grafos grandes, exporte as matrizes com write_distances_matrix e write_predecessors_matrix
+    if (skip_pretty_print("Floyd-Warshall Result", graph.get_order())) {
+        return;
+    }
     std::cout << "Floyd-Warshall Result:\n";
 
    //Imprime a matriz de predecessores
@@ -254,6 +303,9 @@ void print_floyd_warshall_result(const FloydWarshallResult<Node> &result, const
 template<typename Node>
 void print_predecessors_matrix(const std::vector<std::vector<int>>& predecessors, const IGraph<Node>& graph) {
     size_t order = graph.get_order();
+    if (skip_pretty_print("Predecessors Matrix", order)) {
+        return;
+    }
 
     std::cout << "Predecessors Matrix:\n";
 
@@ -279,7 +331,7 @@ void print_predecessors_matrix(const std::vector<std::vector<int>>& predecessors
         for (size_t j = 0; j < order; ++j) {
             if (j < predecessors[i].size() && predecessors[i][j] != -1) {
                 std::cout << "\033[1;32m"
-                          << std::setw(col_width) << std::setprecision(2) << std::fixed << graph.get_nodes()[predecessors[i][j]]
+                          << std::setw(col_width) << std::setprecision(2) << std::fixed << graph.get_node(predecessors[i][j])
                           << "\033[0m"; 
             } else {
                 std::cout << std::setw(col_width) << " -1";
@@ -295,6 +347,9 @@ void print_predecessors_matrix(const std::vector<std::vector<int>>& predecessors
 template<typename Node>
 void print_distances_matrix(const std::vector<std::vector<double>>& distances, const IGraph<Node>& graph) {
     size_t order = graph.get_order();
+    if (skip_pretty_print("Distances Matrix", order)) {
+        return;
+    }
 
     std::cout << "Distances Matrix:\n";
 
@@ -41,8 +41,9 @@ std::list<Node> hierholzer(const IGraph<Node>& graph, int start_index, RemoveEdg
     // Cria uma cópia da lista de adjacência para manipulação
     std::vector<std::list<int>> adj_list(graph.get_order());
     for (size_t i = 0; i < graph.get_order(); i++) {
-        auto neighbors = graph.get_neighbors_indices(i);
-        adj_list[i] = std::list<int>(neighbors.begin(), neighbors.end());
+        graph.for_each_neighbor(i, [&](int neighbor_index) {
+            adj_list[i].push_back(neighbor_index);
+        });
     }
 
 
@@ -7,8 +7,10 @@
 #include <iostream>
 
 #include "graph/IGraph.h"
+#include "graph/IWeightedGraph.h"
 #include "graph/UndirectedAdjacencyListGraph.h"
-#include "utils/Dfs.h"
+#include "graph/GraphBuilder.h"
+#include "utils/ResultWriter.h"
 
 /**
  * @struct KruskalResult
@@ -23,31 +25,63 @@ struct KruskalResult {
 };
 
 /**
- * @struct WeightedEdge
- * @brief Estrutura auxiliar para armazenar arestas com peso e facilitar a ordenação.
+ * @class DisjointSets
+ * @brief Conjuntos disjuntos (union-find) sobre os índices 0..n-1.
+ *
+ * Usa compressão de caminho por halving e união por tamanho, de modo que find e unite
+ * executam em tempo amortizado praticamente constante.
  */
-struct WeightedEdge {
-    int from;
-    int to;
-    double weight;
+class DisjointSets {
+private:
+    std::vector<int> parent;
+    std::vector<int> set_size;
+
+public:
+    explicit DisjointSets(size_t n) : parent(n), set_size(n, 1) {
+        std::iota(parent.begin(), parent.end(), 0);
+    }
+
+    /**
+     * @brief Retorna o representante do conjunto que contém x.
+     */
+    int find(int x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    }
 
     /**
-     * @brief Sempre que você precisar comparar duas WeightedEdge com o operador <, o critério é o campo weight.
+     * @brief Une os conjuntos de a e b.
+     * @return false se a e b já estavam no mesmo conjunto.
      */
-    bool operator<(const WeightedEdge& other) const {
-        return weight < other.weight;
+    bool unite(int a, int b) {
+        a = find(a);
+        b = find(b);
+        if (a == b) {
+            return false;
+        }
+        if (set_size[a] < set_size[b]) {
+            std::swap(a, b);
+        }
+        parent[b] = a;
+        set_size[a] += set_size[b];
+        return true;
     }
 };
 
 /**
  * @brief Implementa o algoritmo de Kruskal para encontrar a Árvore Geradora Mínima.
+ *
+ * A verificação de ciclo usa conjuntos disjuntos sobre os índices do grafo, em vez de uma
+ * DFS na árvore parcial a cada aresta, e o algoritmo executa em O(E log E).
  * @param graph O grafo Onde o algoritmo será aplicado.
- * @param weights A matriz de pesos das arestas do grafo.
+ * @param all_edges Todas as arestas do grafo, com seus pesos.
  * @return O resultado do algoritmo contendo a MST e seu peso total.
  */
 template<typename Node>
-KruskalResult<Node> kruskal(const IGraph<Node>& graph,
-                           const std::vector<std::vector<double>>& weights) {
+KruskalResult<Node> kruskal_edges(const IGraph<Node>& graph, std::vector<WeightedEdge> all_edges) {
 
     KruskalResult<Node> result;
     size_t n = graph.get_order();
@@ -57,55 +91,82 @@ KruskalResult<Node> kruskal(const IGraph<Node>& graph,
         return result;
     }
 
-    std::vector<WeightedEdge> all_edges;
-    std::vector<EdgeIndex> edge_indices = graph.get_all_edges();
-
-    // Percorrer todas as arestas do grafo e armazená-las com seus pesos
-    for (const auto& edge : edge_indices) {
-        all_edges.push_back({edge.from, edge.to, weights[edge.from][edge.to]});
-    }
-
     // Ordena as arestas em ordem crescente de peso
     std::sort(all_edges.begin(), all_edges.end());
 
-    // Adiciona todos os nós do grafo original à árvore resultante
+    // Adiciona todos os nós do grafo original à árvore resultante, com os mesmos índices
+    GraphBuilder<Node> tree_builder(false);
     for (const auto& node : graph.get_nodes()) {
-        result.tree.add_node(node);
+        tree_builder.add_node(node);
     }
 
+    // Cada componente da floresta parcial é um conjunto
+    DisjointSets components(n);
+
     // Loop principal do algoritmo de Kruskal
-    int edges_added_count = 0;
+    size_t edges_added_count = 0;
     for (const auto& edge : all_edges) {
 
-        Node node_from = graph.get_node(edge.from);
-        Node node_to = graph.get_node(edge.to);
+        // Se as extremidades já estão na mesma componente, a aresta formaria um ciclo.
+        if (!components.unite(edge.from, edge.to)) {
+            continue;
+        }
 
-        // Executa a DFS na árvore parcial (result.tree) para verificar alcançabilidade
-        DFSResult<Node> dfs_result;
+        // "T <- T U h_i"
+        tree_builder.add_edge_indices(edge.from, edge.to);
+        result.total_weight += edge.weight;
+        edges_added_count++;
 
-        try {
-            dfs_result = dfs_unidirectional(result.tree, node_from);
-        } catch (const std::invalid_argument& e) {
-            continue;
+        // parar quando a árvore tiver n-1 arestas
+        if (edges_added_count >= n - 1) {
+            break;
         }
+    }
 
-        // Se node_to está no mapa de descoberta e seu tempo é > 0, ele foi alcançado.
-        bool forms_cycle = (dfs_result.discovery.count(node_to) && dfs_result.discovery.at(node_to) > 0);
+    tree_builder.build(result.tree);
+    return result;
+}
 
-        if (!forms_cycle) {
-            // "T <- T U h_i"
-            result.tree.add_edge(node_from, node_to);
-            result.total_weight += edge.weight;
-            edges_added_count++;
+/**
+ * @brief Implementa o algoritmo de Kruskal para encontrar a Árvore Geradora Mínima.
+ * @param graph O grafo Onde o algoritmo será aplicado.
+ * @param weights A matriz de pesos das arestas do grafo.
+ * @return O resultado do algoritmo contendo a MST e seu peso total.
+ */
+template<typename Node>
+KruskalResult<Node> kruskal(const IGraph<Node>& graph,
+                           const std::vector<std::vector<double>>& weights) {
+    std::vector<WeightedEdge> all_edges;
+    std::vector<EdgeIndex> edge_indices = graph.get_all_edges();
 
-            // parar quando a árvore tiver n-1 arestas
-            if (edges_added_count >= n - 1) {
-                break;
+    // Percorrer todas as arestas do grafo e armazená-las com seus pesos
+    for (const auto& edge : edge_indices) {
+        all_edges.push_back({edge.from, edge.to, weights[edge.from][edge.to]});
+    }
+
+    return kruskal_edges(graph, std::move(all_edges));
+}
+
+/**
+ * @brief Implementa o algoritmo de Kruskal em um grafo que armazena os pesos junto às arestas.
+ * @param graph O grafo ponderado onde o algoritmo será aplicado.
+ * @return O resultado do algoritmo contendo a MST e seu peso total.
+ */
+template<typename Node>
+KruskalResult<Node> kruskal(const IWeightedGraph<Node>& graph) {
+    std::vector<WeightedEdge> all_edges;
+
+    // Percorre as arestas junto com seus pesos. Assim como get_all_edges, em grafos
+    // não-direcionados cada aresta é considerada apenas uma vez
+    for (size_t from = 0; from < graph.get_order(); ++from) {
+        graph.for_each_weighted_neighbor(from, [&](int to, double weight) {
+            if (graph.is_directed() || static_cast<int>(from) <= to) {
+                all_edges.push_back({static_cast<int>(from), to, weight});
             }
-        }
+        });
     }
 
-    return result;
+    return kruskal_edges(graph, std::move(all_edges));
 }
 
 /**
@@ -116,7 +177,9 @@ template<typename Node>
 void print_kruskal_result(KruskalResult<Node>& result) {
     std::cout << "Kruskal's Algorithm Result: \n";
     std::cout << "Result: \n";
-    result.tree.print();
+    if (!skip_pretty_print("Minimum spanning tree", result.tree.get_order())) {
+        result.tree.print();
+    }
     std::cout << "Total weight: " << result.total_weight << "\n";
 }
 
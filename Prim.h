@@ -7,9 +7,15 @@
 #include <stdexcept>
 #include <string>
 #include <algorithm>
+#include <queue>
+#include <tuple>
+#include <functional>
 
 #include "graph/IGraph.h"
+#include "graph/IWeightedGraph.h"
 #include "graph/UndirectedAdjacencyListGraph.h"
+#include "graph/GraphBuilder.h"
+#include "utils/ResultWriter.h"
 
 /**
  * @struct PrimResult
@@ -23,12 +29,18 @@ struct PrimResult {
 
 /**
  * @brief Imprime o estado atual de Prim usando o vetor 'added'.
+ *
+ * Para grafos maiores que PRETTY_PRINT_MAX_ORDER, imprime apenas uma linha avisando que o
+ * estado foi omitido.
  */
 template<typename Node>
 void print_prim_state(const std::string& title,
                       const IGraph<Node>& graph,
                       const std::vector<bool>& added,
                       const PrimResult<Node>& result) {
+    if (skip_pretty_print(title.c_str(), added.size())) {
+        return;
+    }
 
     std::cout << "\n" << title << "\n";
     std::cout << "-----------------------------\n";
@@ -69,74 +81,111 @@ void print_prim_state(const std::string& title,
 
 /**
  * @brief Implementação do algoritmo de Prim baseado fielmente no pseudocódigo da imagem.
+ *
+ * A aresta mínima entre Z e N é obtida de uma fila de prioridade com as arestas que saem dos
+ * nós de Z, em vez de percorrer todas as arestas de Z a cada passo, de modo que o algoritmo
+ * executa em O(E log E). Entradas cujo destino já entrou em Z são descartadas ao saírem da
+ * fila. Empates são desfeitos pelo menor índice de origem e, depois, pela posição da aresta
+ * na lista de vizinhos, como na busca linear. A árvore é montada com um GraphBuilder ao
+ * final, sem a verificação de duplicatas de add_edge a cada aresta.
+ * @param for_each_weighted Função que, dado o índice de um nó j e uma função de visita,
+ * chama a visita com o índice e o peso de cada aresta (j, k). Permite que o mesmo algoritmo
+ * seja usado tanto com a matriz de pesos quanto com grafos que armazenam os pesos nas arestas.
  */
-template<typename Node>
-PrimResult<Node> prim(const IGraph<Node>& graph,
-                      const std::vector<std::vector<double>>& weights,
-                      const Node& start) {
+template<typename Node, class ForEachWeighted>
+PrimResult<Node> prim_visit(const IGraph<Node>& graph, const Node& start,
+                            ForEachWeighted for_each_weighted) {
 
     PrimResult<Node> result;
     size_t n = graph.get_order();
 
     if (n == 0) return result;
 
-    // Adiciona todos os vértices ao grafo árvore
-    for (const auto& node : graph.get_nodes()) {
-        result.tree.add_node(node);
-    }
-
     int start_index = graph.get_index(start);
     if (start_index == -1) {
         throw std::runtime_error("Start node does not exist in the graph.");
     }
 
+    // Adiciona todos os vértices ao grafo árvore
+    GraphBuilder<Node> tree_builder(false);
+    for (const auto& node : graph.get_nodes()) {
+        tree_builder.add_node(node);
+    }
+    tree_builder.build(result.tree);
+
     // Representa os nós adicionados à árvore
     std::vector<bool> added(n, false);
 
-    added[start_index] = true;
-    int nodes_added_count = 1;
-
-    print_prim_state("Estado Inicial", graph, added, result);
-
-    while (nodes_added_count < n) {
-
-        double min_weight = std::numeric_limits<double>::infinity();
-        int best_j = -1; // Nó em Z (from)
-        int best_k = -1; // Nó em N (to)
+    // Arestas (peso, j, posição de k na lista de j, k) com j ∈ Z, ordenadas pelo menor peso
+    using QueueEntry = std::tuple<double, int, int, int>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+    auto add_to_z = [&](int j) {
+        added[j] = true;
+        int position = 0;
+        for_each_weighted(j, [&](int k, double weight) {
+            if (!added[k]) {
+                queue.push({weight, j, position, k});
+            }
+            position++;
+        });
+    };
 
-        // Procurar aresta mínima com j ∈ Z e k ∈ N
-        // usando o vetor 'added' para verificar a quais conjuntos eles pertencem.
-        for (int j = 0; j < n; ++j) {
-            // Se 'j' não está em Z, pula (if added[j] is false)
-            if (added[j]){
+    add_to_z(start_index);
+    size_t nodes_added_count = 1;
 
-                for (int k : graph.get_neighbors_indices(j)) {
+    print_prim_state("Estado Inicial", graph, added, result);
 
-                // j ∈ Z, k ∈ N, e (j, k) é uma aresta que existe.
-                if (!added[k] & weights[j][k] < min_weight) {
-                    min_weight = weights[j][k];
-                    best_j = j;
-                    best_k = k;
-                }
-            }
-            }
-        }
+    while (nodes_added_count < n && !queue.empty()) {
+        auto [min_weight, best_j, position, best_k] = queue.top();
+        queue.pop();
 
-        // Grafo desconectado
-        if (best_k == -1) break;
+        // k já entrou em Z por outra aresta
+        if (added[best_k]) continue;
 
-        added[best_k] = true;
+        add_to_z(best_k);
         nodes_added_count++;
 
         // Adiciona a aresta à árvore e soma o peso
-        result.tree.add_edge(graph.get_node(best_j), graph.get_node(best_k));
+        tree_builder.add_edge_indices(best_j, best_k);
         result.total_weight += min_weight;
     }
 
+    result.tree = UndirectedAdjacencyListGraph<Node>();
+    tree_builder.build(result.tree);
+
     print_prim_state("Estado Final", graph, added, result);
     return result;
 }
 
+/**
+ * @brief Executa o algoritmo de Prim usando a matriz de pesos das arestas.
+ * @param graph O grafo onde o algoritmo será aplicado.
+ * @param weights A matriz de pesos das arestas do grafo.
+ * @param start O nó inicial da árvore.
+ */
+template<typename Node>
+PrimResult<Node> prim(const IGraph<Node>& graph,
+                      const std::vector<std::vector<double>>& weights,
+                      const Node& start) {
+    return prim_visit(graph, start, [&](int j, auto visit) {
+        graph.for_each_neighbor(j, [&](int k) {
+            visit(k, weights[j][k]);
+        });
+    });
+}
+
+/**
+ * @brief Executa o algoritmo de Prim em um grafo que armazena os pesos junto às arestas.
+ * @param graph O grafo ponderado onde o algoritmo será aplicado.
+ * @param start O nó inicial da árvore.
+ */
+template<typename Node>
+PrimResult<Node> prim(const IWeightedGraph<Node>& graph, const Node& start) {
+    return prim_visit(graph, start, [&](int j, auto visit) {
+        graph.for_each_weighted_neighbor(j, visit);
+    });
+}
+
 /**
  * @brief Imprime o resultado final do algoritmo de Prim.
  */
@@ -144,7 +193,9 @@ template<typename Node>
 void print_prim_result(PrimResult<Node>& result) {
     std::cout << "\nPrim's Algorithm Result: \n";
     std::cout << "Result: ";
-    result.tree.print();
+    if (!skip_pretty_print("Minimum spanning tree", result.tree.get_order())) {
+        result.tree.print();
+    }
     std::cout << "Total weight: " << result.total_weight << "\n";
 }
 
@@ -0,0 +1,204 @@
+#ifndef BIDIRECTIONALADJACENCYLISTGRAPH_H
+#define BIDIRECTIONALADJACENCYLISTGRAPH_H
+
+#include <algorithm>
+
+#include "DirectedAdjacencyListGraph.h"
+
+/**
+ * @class BidirectionalAdjacencyListGraph
+ * @brief Grafo direcionado com listas de adjacência de saída e de entrada.
+ * @tparam Node O tipo de dado que será armazenado em cada vértice do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
+ *
+ * Além das listas de vizinhos de DirectedAdjacencyListGraph, mantém para cada nó a lista
+ * dos nós que apontam para ele. Assim, o grau de entrada custa O(1) e os vizinhos de entrada
+ * podem ser percorridos diretamente, ao custo de guardar cada aresta duas vezes.
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class BidirectionalAdjacencyListGraph : public DirectedAdjacencyListGraph<Node, NodeMap> {
+    using Base = DirectedAdjacencyListGraph<Node, NodeMap>;
+
+    protected:
+        /*Armazena, para cada nó, os nós que apontam para ele*/
+        std::vector<std::vector<int>> in_adjac;
+
+        /*Remove a primeira ocorrência de 'value' em uma lista de índices*/
+        static void erase_index(std::vector<int>& indices, int value) {
+            auto it = std::find(indices.begin(), indices.end(), value);
+            if (it != indices.end()) {
+                indices.erase(it);
+            }
+        }
+
+        /*Reconstrói as listas de entrada a partir das listas de saída, em O(V + E)*/
+        void rebuild_in_adjacency() {
+            in_adjac.assign(this->adjac.size(), {});
+            for (size_t from_index = 0; from_index < this->adjac.size(); ++from_index) {
+                for (int to_index : this->adjac[from_index]) {
+                    in_adjac[to_index].push_back(static_cast<int>(from_index));
+                }
+            }
+        }
+
+        /*Troca a primeira ocorrência de 'old_value' por 'new_value' em uma lista de índices*/
+        static void replace_index(std::vector<int>& indices, int old_value, int new_value) {
+            auto it = std::find(indices.begin(), indices.end(), old_value);
+            if (it != indices.end()) {
+                *it = new_value;
+            }
+        }
+
+    public:
+        void add_node(const Node& node) override {
+            Base::add_node(node);
+            /*Mantém uma lista de entrada para cada lista de saída*/
+            in_adjac.resize(this->adjac.size());
+        }
+
+        /**
+         * @brief Remove um nó e todas as arestas ligadas a ele.
+         *
+         * As listas de entrada indicam exatamente quais listas de saída contêm o nó, então
+         * apenas as vizinhanças do nó removido e do último nó (que ocupa o seu índice) são visitadas.
+         */
+        void remove_node(const Node& node) override {
+            auto it = this->node_to_index.find(node);
+            if (it == this->node_to_index.end()) {
+                return;
+            }
+
+            int index = static_cast<int>(it->second);
+            int last_index = static_cast<int>(this->index_to_node.size()) - 1;
+
+            /*Desfaz as arestas do nó removido nas listas dos seus vizinhos*/
+            for (int neighbor_index : this->adjac[index]) {
+                if (neighbor_index != index) {
+                    erase_index(in_adjac[neighbor_index], index);
+                }
+            }
+            for (int source_index : in_adjac[index]) {
+                if (source_index != index) {
+                    erase_index(this->adjac[source_index], index);
+                }
+            }
+            /*Desconta os arcos do nó removido; o laço, se existir, aparece nas duas listas mas é um só arco*/
+            bool has_loop = std::find(this->adjac[index].begin(), this->adjac[index].end(), index) != this->adjac[index].end();
+            this->arc_count -= this->adjac[index].size() + in_adjac[index].size() - (has_loop ? 1 : 0);
+            if (has_loop) {
+                this->loop_count--;
+            }
+            this->adjac[index].clear();
+            in_adjac[index].clear();
+
+            /*Move o último nó para o índice liberado, renomeando-o nas listas dos seus vizinhos*/
+            if (index != last_index) {
+                for (int neighbor_index : this->adjac[last_index]) {
+                    if (neighbor_index != last_index) {
+                        replace_index(in_adjac[neighbor_index], last_index, index);
+                    }
+                }
+                for (int source_index : in_adjac[last_index]) {
+                    if (source_index != last_index) {
+                        replace_index(this->adjac[source_index], last_index, index);
+                    }
+                }
+                /*Laços do último nó apontam para ele mesmo nas duas listas*/
+                std::replace(this->adjac[last_index].begin(), this->adjac[last_index].end(), last_index, index);
+                std::replace(in_adjac[last_index].begin(), in_adjac[last_index].end(), last_index, index);
+
+                in_adjac[index] = std::move(in_adjac[last_index]);
+            }
+            in_adjac.pop_back();
+            this->move_last_node_to(index);
+        }
+
+        /**
+         * @brief Remove vários nós de uma só vez.
+         *
+         * As listas de saída são compactadas pela classe base e as de entrada são reconstruídas a
+         * partir delas, em O(V + E) para o lote inteiro.
+         */
+        void remove_nodes(const std::vector<Node>& nodes) override {
+            Base::remove_nodes(nodes);
+            rebuild_in_adjacency();
+        }
+
+        void add_edge(const Node& from, const Node& to) override {
+            add_node(from);
+            add_node(to);
+
+            int from_index = this->get_index(from);
+            int to_index = this->get_index(to);
+
+            /*Registra a aresta nas duas direções apenas se ela ainda não existir*/
+            auto& neighbors_from = this->adjac[from_index];
+            if (std::find(neighbors_from.begin(), neighbors_from.end(), to_index) == neighbors_from.end()) {
+                neighbors_from.push_back(to_index);
+                in_adjac[to_index].push_back(from_index);
+                this->arc_count++;
+                if (from_index == to_index) {
+                    this->loop_count++;
+                }
+            }
+        }
+
+        void remove_edge(const Node& from, const Node& to) override {
+            int from_index = this->get_index(from);
+            int to_index = this->get_index(to);
+            if (from_index == -1 || to_index == -1) {
+                return;
+            }
+
+            auto& neighbors_from = this->adjac[from_index];
+            auto it = std::find(neighbors_from.begin(), neighbors_from.end(), to_index);
+            if (it != neighbors_from.end()) {
+                neighbors_from.erase(it);
+                erase_index(in_adjac[to_index], from_index);
+                this->arc_count--;
+                if (from_index == to_index) {
+                    this->loop_count--;
+                }
+            }
+        }
+
+        /**
+         * @brief Adiciona arcos já agrupados por origem e sem repetições.
+         *
+         * Se o grafo ainda não possuía arestas, as listas de saída são preenchidas pela classe
+         * base e as de entrada reconstruídas de uma só vez; caso contrário, cada arco passa por add_edge.
+         */
+        void add_adjacency(const std::vector<size_t>& offsets, const std::vector<int>& targets) override {
+            bool was_empty = this->arc_count == 0;
+            Base::add_adjacency(offsets, targets);
+            if (was_empty) {
+                rebuild_in_adjacency();
+            }
+        }
+
+        bool for_each_in_neighbor(int index, NeighborVisitor visit) const override {
+            /*Caso o índice seja inválido, lança uma exceção*/
+            if (index < 0 || static_cast<size_t>(index) >= in_adjac.size()) {
+                throw std::out_of_range("for_each_in_neighbor: Index out of range");
+            }
+            for (int source_index : in_adjac[index]) {
+                if (!visit(source_index)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        /*As listas de entrada ficam em in_adjac*/
+        bool has_in_neighbor_access() const override {
+            return true;
+        }
+
+        /*O grau de entrada é o tamanho da lista de entrada*/
+        size_t get_in_degree(const Node& node) const override {
+            int node_index = this->get_index(node);
+            return node_index == -1 ? 0 : in_adjac[node_index].size();
+        }
+};
+
+#endif // BIDIRECTIONALADJACENCYLISTGRAPH_H
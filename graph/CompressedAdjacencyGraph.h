@@ -0,0 +1,435 @@
+#ifndef COMPRESSEDADJACENCYGRAPH_H
+#define COMPRESSEDADJACENCYGRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+#include <limits>
+#include <cstdint>
+
+#include "IGraph.h"
+#include "NodeMap.h"
+#include "GraphBuilder.h"
+
+/**
+ * @namespace varint
+ * @brief Codificação de inteiros sem sinal em 7 bits por byte (LEB128).
+ *
+ * Valores menores que 128 ocupam um byte, menores que 16384 ocupam dois, e assim por diante;
+ * o bit mais alto de cada byte indica se o valor continua no próximo byte.
+ */
+namespace varint {
+
+inline void encode(std::vector<uint8_t>& out, uint64_t value) {
+    while (value >= 0x80) {
+        out.push_back(static_cast<uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    out.push_back(static_cast<uint8_t>(value));
+}
+
+/*Lê um valor e avança o ponteiro; o caso de um único byte, o mais comum, não entra no laço*/
+inline uint64_t decode(const uint8_t*& in) {
+    uint64_t byte = *in++;
+    if (byte < 0x80) {
+        return byte;
+    }
+    uint64_t value = byte & 0x7F;
+    int shift = 7;
+    do {
+        byte = *in++;
+        value |= (byte & 0x7F) << shift;
+        shift += 7;
+    } while (byte & 0x80);
+    return value;
+}
+
+/*Mapeia inteiros com sinal para sem sinal, intercalando positivos e negativos: 0, -1, 1, -2, ...*/
+inline uint64_t zigzag(int64_t value) {
+    return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t unzigzag(uint64_t value) {
+    return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+}
+
+} // namespace varint
+
+/**
+ * @class CompressedAdjacencyGraph
+ * @brief Representação imutável e comprimida das listas de adjacência, no estilo do WebGraph.
+ * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
+ *
+ * Os vizinhos de cada nó são ordenados e guardados como diferenças entre vizinhos
+ * consecutivos, codificadas em varint: o grau, a distância do primeiro vizinho até o próprio
+ * nó (com sinal, em zigzag) e, para os demais, a diferença até o vizinho anterior menos um.
+ * Em grafos reais os vizinhos de um nó costumam ter índices próximos, então a maior parte
+ * das diferenças cabe em um ou dois bytes, em vez dos quatro bytes de cada int do CSR.
+ *
+ * Os deslocamentos de cada lista no vetor de bytes também são compactados: um deslocamento
+ * completo a cada OFFSET_BLOCK nós e, para cada nó, a distância em 32 bits até o início do bloco.
+ *
+ * Percorrer os vizinhos é uma decodificação sequencial, então BFS, is_connected e a busca de
+ * componentes (bfs_digraph) funcionam diretamente sobre esta representação, trocando um pouco
+ * de processamento pela memória. Os vizinhos de cada nó são visitados em ordem crescente de
+ * índice. O grafo não possui pesos, e as operações de inserção e remoção lançam std::logic_error.
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class CompressedAdjacencyGraph : public IGraph<Node> {
+protected:
+    // Número de nós que compartilham um deslocamento completo.
+    static constexpr size_t OFFSET_BLOCK = 64;
+
+    // Listas de adjacência codificadas, uma após a outra, na ordem dos índices.
+    std::vector<uint8_t> data;
+    // Deslocamento em data do primeiro nó de cada bloco de OFFSET_BLOCK nós.
+    std::vector<size_t> block_offsets;
+    // Deslocamento de cada nó em relação ao início do seu bloco.
+    std::vector<uint32_t> node_offsets;
+    // Grau de entrada de cada nó, calculado na construção.
+    std::vector<uint32_t> in_degrees;
+    // Vetor para mapear um índice ao seu nó correspondente.
+    std::vector<Node> index_to_node;
+    // Mapa para mapear um nó ao seu índice correspondente.
+    NodeMap node_to_index;
+    // Número de arestas do grafo (em grafos não-direcionados, cada aresta é contada uma vez).
+    size_t edge_count = 0;
+    // Indica se as arestas são direcionadas.
+    bool directed = true;
+
+    /**
+     * @brief Registra os nós do grafo, na ordem dos índices.
+     * @param nodes Os nós do grafo.
+     */
+    void set_nodes(const std::vector<Node>& nodes) {
+        index_to_node = nodes;
+        node_to_index.reserve(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (!node_to_index.emplace(nodes[i], i).second) {
+                throw std::invalid_argument("CompressedAdjacencyGraph: duplicated node");
+            }
+        }
+        in_degrees.assign(nodes.size(), 0);
+        node_offsets.reserve(nodes.size());
+        block_offsets.reserve(nodes.size() / OFFSET_BLOCK + 1);
+    }
+
+    /**
+     * @brief Codifica a lista de vizinhos do próximo nó, ordenando-a e removendo repetições.
+     * @param list Os índices dos vizinhos; o vetor é reordenado.
+     * @throws std::length_error se um bloco de OFFSET_BLOCK listas passar de 4 GiB.
+     */
+    void append_list(std::vector<int>& list) {
+        size_t index = node_offsets.size();
+        if (index % OFFSET_BLOCK == 0) {
+            block_offsets.push_back(data.size());
+        }
+        size_t relative = data.size() - block_offsets.back();
+        if (relative > std::numeric_limits<uint32_t>::max()) {
+            throw std::length_error("CompressedAdjacencyGraph: adjacency block too large");
+        }
+        node_offsets.push_back(static_cast<uint32_t>(relative));
+
+        std::sort(list.begin(), list.end());
+        list.erase(std::unique(list.begin(), list.end()), list.end());
+
+        varint::encode(data, list.size());
+        if (list.empty()) {
+            return;
+        }
+        varint::encode(data, varint::zigzag(static_cast<int64_t>(list[0]) - static_cast<int64_t>(index)));
+        in_degrees[list[0]]++;
+        for (size_t k = 1; k < list.size(); ++k) {
+            varint::encode(data, static_cast<uint64_t>(list[k] - list[k - 1] - 1));
+            in_degrees[list[k]]++;
+        }
+    }
+
+    /**
+     * @brief Retorna o início da lista codificada de um nó.
+     */
+    const uint8_t* list_begin(int index) const {
+        return data.data() + block_offsets[index / OFFSET_BLOCK] + node_offsets[index];
+    }
+
+    /**
+     * @brief Decodifica os vizinhos de um nó em ordem crescente, chamando visit para cada um.
+     * @return false se visit interromper a decodificação retornando false.
+     */
+    template<typename Visit>
+    bool decode_list(int index, Visit&& visit) const {
+        const uint8_t* in = list_begin(index);
+        uint64_t degree = varint::decode(in);
+        if (degree == 0) {
+            return true;
+        }
+        int neighbor = static_cast<int>(index + varint::unzigzag(varint::decode(in)));
+        if (!visit(neighbor)) {
+            return false;
+        }
+        for (uint64_t k = 1; k < degree; ++k) {
+            neighbor += static_cast<int>(varint::decode(in)) + 1;
+            if (!visit(neighbor)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Retorna o grau de saída de um nó, lendo apenas o início da sua lista.
+     */
+    size_t degree_of(int index) const {
+        const uint8_t* in = list_begin(index);
+        return static_cast<size_t>(varint::decode(in));
+    }
+
+    /**
+     * @brief Libera a memória reservada a mais durante a construção.
+     */
+    void shrink() {
+        data.shrink_to_fit();
+        block_offsets.shrink_to_fit();
+        node_offsets.shrink_to_fit();
+    }
+
+    /**
+     * @brief Verifica se um índice de nó é válido.
+     * @param index O índice a ser verificado.
+     * @param message A mensagem da exceção lançada.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    void check_index(int index, const char* message) const {
+        if (index < 0 || static_cast<size_t>(index) >= index_to_node.size()) {
+            throw std::out_of_range(message);
+        }
+    }
+
+public:
+    /**
+     * @brief Constrói a representação comprimida a partir de qualquer grafo.
+     *
+     * Os nós mantêm os mesmos índices do grafo de origem; cada lista de vizinhos é copiada,
+     * ordenada e codificada, então o pico de memória é o do grafo de origem mais a lista do
+     * maior grau.
+     * @param graph O grafo de origem.
+     */
+    explicit CompressedAdjacencyGraph(const IGraph<Node>& graph)
+        : directed(graph.is_directed()) {
+        set_nodes(graph.get_nodes());
+
+        std::vector<int> list;
+        for (size_t i = 0; i < index_to_node.size(); ++i) {
+            list.clear();
+            graph.for_each_neighbor(i, [&list](int neighbor_index) {
+                list.push_back(neighbor_index);
+            });
+            append_list(list);
+        }
+        shrink();
+        edge_count = graph.get_size();
+    }
+
+    /**
+     * @brief Constrói a representação comprimida a partir das arestas acumuladas em um GraphBuilder.
+     *
+     * Os nós mantêm os índices do construtor e os pesos são ignorados.
+     * @param builder O construtor com os nós e as arestas do grafo.
+     */
+    template<typename BuilderNodeMap>
+    explicit CompressedAdjacencyGraph(const GraphBuilder<Node, BuilderNodeMap>& builder)
+        : directed(builder.is_directed()) {
+        set_nodes(builder.get_nodes());
+
+        AdjacencyArrays arrays = builder.adjacency();
+        std::vector<int> list;
+        size_t loop_count = 0;
+        for (size_t i = 0; i < index_to_node.size(); ++i) {
+            list.assign(arrays.targets.begin() + arrays.offsets[i], arrays.targets.begin() + arrays.offsets[i + 1]);
+            loop_count += std::count(list.begin(), list.end(), static_cast<int>(i));
+            append_list(list);
+        }
+        shrink();
+        size_t arc_count = arrays.targets.size();
+        edge_count = directed ? arc_count : (arc_count - loop_count) / 2 + loop_count;
+    }
+
+    /**
+     * @brief Retorna a memória ocupada pelas listas de adjacência e pelos deslocamentos, em bytes.
+     *
+     * Não inclui os vetores de nós e o mapeamento de nós para índices, que são os mesmos das
+     * outras representações.
+     */
+    size_t adjacency_bytes() const {
+        return data.size() + block_offsets.size() * sizeof(size_t) + node_offsets.size() * sizeof(uint32_t)
+               + in_degrees.size() * sizeof(uint32_t);
+    }
+
+    size_t get_order() const override {
+        return index_to_node.size();
+    }
+
+    size_t get_size() const override {
+        return edge_count;
+    }
+
+    void add_node(const Node&) override {
+        throw std::logic_error("CompressedAdjacencyGraph is immutable");
+    }
+
+    void remove_node(const Node&) override {
+        throw std::logic_error("CompressedAdjacencyGraph is immutable");
+    }
+
+    void add_edge(const Node&, const Node&) override {
+        throw std::logic_error("CompressedAdjacencyGraph is immutable");
+    }
+
+    void remove_edge(const Node&, const Node&) override {
+        throw std::logic_error("CompressedAdjacencyGraph is immutable");
+    }
+
+    std::vector<Node> get_neighbors(const Node& node) const override {
+        int index = get_index(node);
+        if (index == -1) {
+            return {};
+        }
+
+        std::vector<Node> result;
+        result.reserve(degree_of(index));
+        decode_list(index, [&](int neighbor) {
+            result.push_back(index_to_node[neighbor]);
+            return true;
+        });
+        return result;
+    }
+
+    std::vector<Node> get_nodes() const override {
+        return index_to_node;
+    }
+
+    bool has_node(const Node& node) const override {
+        return node_to_index.find(node) != node_to_index.end();
+    }
+
+    /**
+     * @brief Imprime o grafo no mesmo formato utilizado pela lista de adjacência.
+     */
+    void print() const override {
+        std::cout << "Graph (compressed, " << (directed ? "directed" : "undirected")
+                  << ", order: " << get_order() << ", size: " << get_size() << "):\n";
+        for (size_t i = 0; i < index_to_node.size(); ++i) {
+            std::cout << index_to_node[i] << ": ";
+            decode_list(i, [this](int neighbor) {
+                std::cout << index_to_node[neighbor] << " ";
+                return true;
+            });
+            std::cout << "\n";
+        }
+        std::cout << std::endl;
+    }
+
+    int get_index(const Node& node) const override {
+        auto it = node_to_index.find(node);
+        if (it != node_to_index.end()) {
+            return it->second;
+        }
+        return -1;
+    }
+
+    Node get_node(int index) const override {
+        check_index(index, "get_node: Index out of range");
+        return index_to_node[index];
+    }
+
+    std::vector<int> get_neighbors_indices(int index) const override {
+        check_index(index, "get_neighbors_indices: Index out of range");
+        std::vector<int> result;
+        result.reserve(degree_of(index));
+        decode_list(index, [&result](int neighbor) {
+            result.push_back(neighbor);
+            return true;
+        });
+        return result;
+    }
+
+    bool for_each_neighbor(int index, NeighborVisitor visit) const override {
+        check_index(index, "for_each_neighbor: Index out of range");
+        return decode_list(index, [&visit](int neighbor) {
+            return visit(neighbor);
+        });
+    }
+
+    /**
+     * @brief Percorre os nós com arco até o nó de índice 'index'.
+     *
+     * Como as listas estão ordenadas, a decodificação de cada lista para assim que passa do índice.
+     */
+    bool for_each_in_neighbor(int index, NeighborVisitor visit) const override {
+        if (!directed) {
+            return for_each_neighbor(index, visit);
+        }
+        check_index(index, "for_each_in_neighbor: Index out of range");
+
+        for (int from = 0; from < static_cast<int>(index_to_node.size()); ++from) {
+            bool found = false;
+            decode_list(from, [&](int neighbor) {
+                found = neighbor == index;
+                return neighbor < index;
+            });
+            if (found && !visit(from)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    size_t get_in_degree(const Node& node) const override {
+        int index = get_index(node);
+        return index == -1 ? 0 : in_degrees[index];
+    }
+
+    size_t get_out_degree(const Node& node) const override {
+        int index = get_index(node);
+        return index == -1 ? 0 : degree_of(index);
+    }
+
+    bool is_adjacent(const Node& u, const Node& v) const override {
+        int u_index = get_index(u);
+        int v_index = get_index(v);
+        if (u_index == -1 || v_index == -1) {
+            return false;
+        }
+        bool found = false;
+        decode_list(u_index, [&](int neighbor) {
+            found = neighbor == v_index;
+            return neighbor < v_index;
+        });
+        return found;
+    }
+
+    std::vector<EdgeIndex> get_all_edges() const override {
+        std::vector<EdgeIndex> edges;
+        edges.reserve(edge_count);
+        for (size_t from = 0; from < index_to_node.size(); ++from) {
+            int from_index = static_cast<int>(from);
+            decode_list(from_index, [&](int neighbor) {
+                // Em grafos não-direcionados, cada aresta é devolvida apenas uma vez
+                if (directed || from_index <= neighbor) {
+                    edges.push_back(EdgeIndex{from_index, neighbor});
+                }
+                return true;
+            });
+        }
+        return edges;
+    }
+
+    bool is_directed() const override {
+        return directed;
+    }
+};
+
+#endif // COMPRESSEDADJACENCYGRAPH_H
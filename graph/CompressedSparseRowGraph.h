@@ -0,0 +1,448 @@
+#ifndef COMPRESSEDSPARSEROWGRAPH_H
+#define COMPRESSEDSPARSEROWGRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <stdexcept>
+#include <algorithm>
+
+#include "IWeightedGraph.h"
+#include "NodeMap.h"
+#include "GraphBuilder.h"
+
+/**
+ * @class CompressedSparseRowGraph
+ * @brief Implementação imutável de um grafo no formato CSR (Compressed Sparse Row).
+ * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
+ *
+ * Os vizinhos de todos os nós ficam armazenados em um único vetor contíguo, e um vetor de
+ * deslocamentos indica onde começa a lista de cada nó: os vizinhos do nó de índice i estão
+ * em neighbors[offsets[i]] .. neighbors[offsets[i + 1] - 1]. Dessa forma, percorrer os
+ * vizinhos de um nó é uma leitura sequencial de memória e não há uma alocação por vértice.
+ *
+ * Os pesos, quando existem, ficam em um vetor paralelo ao de vizinhos (weights[k] é o peso
+ * da aresta até neighbors[k]). Grafos sem pesos não ocupam memória com eles e todas as suas
+ * arestas têm peso 1.
+ *
+ * Como a estrutura é compacta, o grafo não pode ser modificado após a construção: as
+ * operações de inserção e remoção lançam std::logic_error.
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class CompressedSparseRowGraph : public IWeightedGraph<Node> {
+public:
+    using IWeightedGraph<Node>::add_edge;
+
+protected:
+    // Deslocamentos de cada nó no vetor de vizinhos (tamanho ordem + 1).
+    std::vector<size_t> offsets;
+    // Vizinhos de todos os nós, armazenados de forma contígua.
+    std::vector<int> neighbors;
+    // Peso de cada aresta, paralelo ao vetor de vizinhos (vazio em grafos sem pesos).
+    std::vector<double> weights;
+    // Grau de entrada de cada nó, calculado na construção.
+    std::vector<size_t> in_degrees;
+    // Vetor para mapear um índice ao seu nó correspondente.
+    std::vector<Node> index_to_node;
+    // Mapa para mapear um nó ao seu índice correspondente.
+    NodeMap node_to_index;
+    // Número de arestas do grafo (em grafos não-direcionados, cada aresta é contada uma vez).
+    size_t edge_count = 0;
+    // Indica se as arestas são direcionadas.
+    bool directed = true;
+
+    /**
+     * @brief Registra os nós do grafo, na ordem dos índices.
+     * @param nodes Os nós do grafo.
+     */
+    void set_nodes(const std::vector<Node>& nodes) {
+        index_to_node = nodes;
+        node_to_index.reserve(nodes.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            if (!node_to_index.emplace(nodes[i], i).second) {
+                throw std::invalid_argument("CompressedSparseRowGraph: duplicated node");
+            }
+        }
+    }
+
+    /**
+     * @brief Monta os vetores de deslocamentos e vizinhos a partir de uma lista de arestas.
+     *
+     * As arestas são agrupadas por nó de origem com group_arcs, preservando a ordem em que
+     * aparecem na lista. Arestas repetidas são descartadas, assim como faria uma sequência de
+     * chamadas a add_edge; em grafos ponderados, prevalece o último peso informado para a aresta.
+     * @param edges As arestas, dadas por índices e pesos.
+     * @param weighted Indica se os pesos das arestas devem ser armazenados.
+     */
+    void build(const std::vector<WeightedEdge>& edges, bool weighted) {
+        std::vector<int> sources;
+        std::vector<int> targets;
+        std::vector<double> edge_weights;
+        sources.reserve(edges.size());
+        targets.reserve(edges.size());
+        if (weighted) {
+            edge_weights.reserve(edges.size());
+        }
+        for (const WeightedEdge& edge : edges) {
+            sources.push_back(edge.from);
+            targets.push_back(edge.to);
+            if (weighted) {
+                edge_weights.push_back(edge.weight);
+            }
+        }
+        set_adjacency(group_arcs(index_to_node.size(), sources, targets, edge_weights, directed));
+    }
+
+    /**
+     * @brief Adota arcos já agrupados por origem e sem repetições, calculando os graus e o tamanho.
+     * @param arrays Os arcos no formato produzido por group_arcs.
+     */
+    void set_adjacency(AdjacencyArrays&& arrays) {
+        offsets = std::move(arrays.offsets);
+        neighbors = std::move(arrays.targets);
+        weights = std::move(arrays.weights);
+
+        compute_in_degrees();
+
+        if (directed) {
+            edge_count = neighbors.size();
+        } else {
+            size_t loop_count = 0;
+            for (size_t from = 0; from < index_to_node.size(); ++from) {
+                for (size_t k = offsets[from]; k < offsets[from + 1]; ++k) {
+                    if (neighbors[k] == static_cast<int>(from)) {
+                        loop_count++;
+                    }
+                }
+            }
+            edge_count = (neighbors.size() - loop_count) / 2 + loop_count;
+        }
+    }
+
+    /**
+     * @brief Calcula o grau de entrada de todos os nós contando as ocorrências no vetor de vizinhos.
+     */
+    void compute_in_degrees() {
+        in_degrees.assign(index_to_node.size(), 0);
+        for (int to : neighbors) {
+            in_degrees[to]++;
+        }
+    }
+
+    /**
+     * @brief Verifica se um índice de nó é válido.
+     * @param index O índice a ser verificado.
+     * @param message A mensagem da exceção lançada.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    void check_index(int index, const char* message) const {
+        if (index < 0 || static_cast<size_t>(index) >= index_to_node.size()) {
+            throw std::out_of_range(message);
+        }
+    }
+
+public:
+    /**
+     * @brief Constrói a representação CSR a partir de qualquer grafo.
+     *
+     * Os nós mantêm os mesmos índices do grafo de origem, e os vizinhos de cada nó
+     * mantêm a mesma ordem, de modo que as travessias produzem os mesmos resultados.
+     * Se o grafo de origem for ponderado (IWeightedGraph), os pesos também são copiados.
+     * @param graph O grafo de origem.
+     */
+    explicit CompressedSparseRowGraph(const IGraph<Node>& graph)
+        : directed(graph.is_directed()) {
+        set_nodes(graph.get_nodes());
+
+        auto weighted_graph = dynamic_cast<const IWeightedGraph<Node>*>(&graph);
+        size_t order = index_to_node.size();
+        offsets.assign(order + 1, 0);
+        for (size_t i = 0; i < order; ++i) {
+            if (weighted_graph != nullptr) {
+                weighted_graph->for_each_weighted_neighbor(i, [this](int neighbor_index, double weight) {
+                    neighbors.push_back(neighbor_index);
+                    weights.push_back(weight);
+                });
+            } else {
+                graph.for_each_neighbor(i, [this](int neighbor_index) {
+                    neighbors.push_back(neighbor_index);
+                });
+            }
+            offsets[i + 1] = neighbors.size();
+        }
+        neighbors.shrink_to_fit();
+        weights.shrink_to_fit();
+
+        compute_in_degrees();
+        edge_count = graph.get_size();
+    }
+
+    /**
+     * @brief Constrói a representação CSR a partir de um grafo e da sua matriz de pesos.
+     *
+     * Permite converter os dados usados pelas versões dos algoritmos baseadas em matriz
+     * (como os preenchidos por populate_graph_weighted_from_file) para a representação
+     * em que o peso fica ao lado de cada vizinho.
+     * @param graph O grafo de origem.
+     * @param weight_matrix A matriz de pesos, indexada pelos índices dos nós do grafo.
+     */
+    CompressedSparseRowGraph(const IGraph<Node>& graph, const std::vector<std::vector<double>>& weight_matrix)
+        : CompressedSparseRowGraph(graph) {
+        weights.resize(neighbors.size());
+        for (size_t from = 0; from < index_to_node.size(); ++from) {
+            for (size_t k = offsets[from]; k < offsets[from + 1]; ++k) {
+                weights[k] = weight_matrix[from][neighbors[k]];
+            }
+        }
+    }
+
+    /**
+     * @brief Constrói a representação CSR a partir das arestas acumuladas em um GraphBuilder.
+     *
+     * Os nós mantêm os índices do construtor, e os pesos são armazenados apenas se alguma
+     * aresta tiver sido registrada com peso.
+     * @param builder O construtor com os nós e as arestas do grafo.
+     */
+    template<typename BuilderNodeMap>
+    explicit CompressedSparseRowGraph(const GraphBuilder<Node, BuilderNodeMap>& builder)
+        : directed(builder.is_directed()) {
+        set_nodes(builder.get_nodes());
+        set_adjacency(builder.adjacency());
+    }
+
+    /**
+     * @brief Constrói a representação CSR a partir de uma lista de nós e de arestas por índice.
+     * @param nodes Os nós do grafo; o nó na posição i recebe o índice i.
+     * @param edges As arestas do grafo, dadas pelos índices dos nós em 'nodes'.
+     * @param is_directed Indica se as arestas são direcionadas.
+     * @throws std::out_of_range se alguma aresta referenciar um índice inválido.
+     */
+    CompressedSparseRowGraph(const std::vector<Node>& nodes, const std::vector<EdgeIndex>& edges,
+                             bool is_directed = true)
+        : directed(is_directed) {
+        set_nodes(nodes);
+
+        std::vector<WeightedEdge> unit_edges;
+        unit_edges.reserve(edges.size());
+        for (const EdgeIndex& edge : edges) {
+            unit_edges.push_back(WeightedEdge{edge.from, edge.to, 1.0});
+        }
+        build(unit_edges, false);
+    }
+
+    /**
+     * @brief Constrói a representação CSR ponderada a partir de uma lista de nós e de arestas com peso.
+     * @param nodes Os nós do grafo; o nó na posição i recebe o índice i.
+     * @param edges As arestas do grafo, dadas pelos índices dos nós em 'nodes' e pelo peso.
+     * @param is_directed Indica se as arestas são direcionadas.
+     * @throws std::out_of_range se alguma aresta referenciar um índice inválido.
+     */
+    CompressedSparseRowGraph(const std::vector<Node>& nodes, const std::vector<WeightedEdge>& edges,
+                             bool is_directed = true)
+        : directed(is_directed) {
+        set_nodes(nodes);
+        build(edges, true);
+    }
+
+    /**
+     * @brief Constrói a representação CSR diretamente a partir de uma lista de arestas.
+     *
+     * Os nós recebem índices na ordem em que aparecem pela primeira vez na lista.
+     * @param edges As arestas do grafo, como pares (origem, destino).
+     * @param is_directed Indica se as arestas são direcionadas.
+     */
+    explicit CompressedSparseRowGraph(const std::vector<std::pair<Node, Node>>& edges,
+                                      bool is_directed = true)
+        : directed(is_directed) {
+        std::vector<WeightedEdge> index_edges;
+        index_edges.reserve(edges.size());
+
+        // Atribui índices aos nós conforme aparecem.
+        auto index_of = [this](const Node& node) {
+            auto it = node_to_index.find(node);
+            if (it != node_to_index.end()) {
+                return static_cast<int>(it->second);
+            }
+            node_to_index.emplace(node, index_to_node.size());
+            index_to_node.push_back(node);
+            return static_cast<int>(index_to_node.size() - 1);
+        };
+
+        for (const auto& edge : edges) {
+            int from = index_of(edge.first);
+            int to = index_of(edge.second);
+            index_edges.push_back(WeightedEdge{from, to, 1.0});
+        }
+
+        build(index_edges, false);
+    }
+
+    size_t get_order() const override {
+        return index_to_node.size();
+    }
+
+    size_t get_size() const override {
+        return edge_count;
+    }
+
+    void add_node(const Node&) override {
+        throw std::logic_error("CompressedSparseRowGraph is immutable");
+    }
+
+    void remove_node(const Node&) override {
+        throw std::logic_error("CompressedSparseRowGraph is immutable");
+    }
+
+    void add_edge(const Node&, const Node&) override {
+        throw std::logic_error("CompressedSparseRowGraph is immutable");
+    }
+
+    void add_edge(const Node&, const Node&, double) override {
+        throw std::logic_error("CompressedSparseRowGraph is immutable");
+    }
+
+    void remove_edge(const Node&, const Node&) override {
+        throw std::logic_error("CompressedSparseRowGraph is immutable");
+    }
+
+    std::vector<Node> get_neighbors(const Node& node) const override {
+        int index = get_index(node);
+        if (index == -1) {
+            return {};
+        }
+
+        std::vector<Node> result;
+        result.reserve(offsets[index + 1] - offsets[index]);
+        for (size_t k = offsets[index]; k < offsets[index + 1]; ++k) {
+            result.push_back(index_to_node[neighbors[k]]);
+        }
+        return result;
+    }
+
+    std::vector<Node> get_nodes() const override {
+        return index_to_node;
+    }
+
+    bool has_node(const Node& node) const override {
+        return node_to_index.find(node) != node_to_index.end();
+    }
+
+    /**
+     * @brief Imprime o grafo no mesmo formato utilizado pela lista de adjacência.
+     */
+    void print() const override {
+        std::cout << "Graph (CSR, " << (directed ? "directed" : "undirected")
+                  << ", order: " << get_order() << ", size: " << get_size() << "):\n";
+        for (size_t i = 0; i < index_to_node.size(); ++i) {
+            std::cout << index_to_node[i] << ": ";
+            for (size_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+                std::cout << index_to_node[neighbors[k]];
+                if (!weights.empty()) {
+                    std::cout << "(" << weights[k] << ")";
+                }
+                std::cout << " ";
+            }
+            std::cout << "\n";
+        }
+        std::cout << std::endl;
+    }
+
+    int get_index(const Node& node) const override {
+        auto it = node_to_index.find(node);
+        if (it != node_to_index.end()) {
+            return it->second;
+        }
+        return -1;
+    }
+
+    Node get_node(int index) const override {
+        check_index(index, "get_node: Index out of range");
+        return index_to_node[index];
+    }
+
+    std::vector<int> get_neighbors_indices(int index) const override {
+        check_index(index, "get_neighbors_indices: Index out of range");
+        return std::vector<int>(neighbors.begin() + offsets[index], neighbors.begin() + offsets[index + 1]);
+    }
+
+    bool for_each_neighbor(int index, NeighborVisitor visit) const override {
+        check_index(index, "for_each_neighbor: Index out of range");
+        for (size_t k = offsets[index]; k < offsets[index + 1]; ++k) {
+            if (!visit(neighbors[k])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool for_each_weighted_neighbor(int index, WeightedNeighborVisitor visit) const override {
+        check_index(index, "for_each_weighted_neighbor: Index out of range");
+        for (size_t k = offsets[index]; k < offsets[index + 1]; ++k) {
+            if (!visit(neighbors[k], weights.empty() ? 1.0 : weights[k])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    double get_weight(int from_index, int to_index) const override {
+        check_index(from_index, "get_weight: Index out of range");
+        for (size_t k = offsets[from_index]; k < offsets[from_index + 1]; ++k) {
+            if (neighbors[k] == to_index) {
+                return weights.empty() ? 1.0 : weights[k];
+            }
+        }
+        return std::numeric_limits<double>::infinity();
+    }
+
+    /**
+     * @brief Indica se o grafo armazena pesos para as arestas.
+     * @return true se os pesos foram fornecidos na construção, false se todas as arestas têm peso 1.
+     */
+    bool is_weighted() const {
+        return !weights.empty();
+    }
+
+    size_t get_in_degree(const Node& node) const override {
+        int index = get_index(node);
+        return index == -1 ? 0 : in_degrees[index];
+    }
+
+    size_t get_out_degree(const Node& node) const override {
+        int index = get_index(node);
+        return index == -1 ? 0 : offsets[index + 1] - offsets[index];
+    }
+
+    bool is_adjacent(const Node& u, const Node& v) const override {
+        int u_index = get_index(u);
+        int v_index = get_index(v);
+        if (u_index == -1 || v_index == -1) {
+            return false;
+        }
+        auto begin = neighbors.begin() + offsets[u_index];
+        auto end = neighbors.begin() + offsets[u_index + 1];
+        return std::find(begin, end, v_index) != end;
+    }
+
+    std::vector<EdgeIndex> get_all_edges() const override {
+        std::vector<EdgeIndex> edges;
+        edges.reserve(directed ? neighbors.size() : edge_count);
+        for (size_t from = 0; from < index_to_node.size(); ++from) {
+            for (size_t k = offsets[from]; k < offsets[from + 1]; ++k) {
+                // Em grafos não-direcionados, cada aresta é devolvida apenas uma vez
+                if (directed || static_cast<int>(from) <= neighbors[k]) {
+                    edges.push_back(EdgeIndex{static_cast<int>(from), neighbors[k]});
+                }
+            }
+        }
+        return edges;
+    }
+
+    bool is_directed() const override {
+        return directed;
+    }
+};
+
+#endif // COMPRESSEDSPARSEROWGRAPH_H
@@ -5,11 +5,13 @@
 #include <vector>
 #include <unordered_map>
 #include <algorithm>
+#include <cassert>
 
 #include "IGraph.h"
+#include "NodeMap.h"
 
 /* Implementação de um grafo dirigido usando listas de adjacência */
-template<typename Node>
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
 class DirectedAdjacencyListGraph : public IGraph<Node> {
     protected:
         /*Armazena vizinhos de cada nó*/
@@ -17,7 +19,43 @@ class DirectedAdjacencyListGraph : public IGraph<Node> {
         /*Armazena nós por índice*/
         std::vector<Node> index_to_node;   
         /*Mapeia nós para seus índices*/        
-        std::unordered_map<Node, size_t> node_to_index; 
+        NodeMap node_to_index; 
+        /*Número de arcos armazenados nas listas, atualizado a cada inserção e remoção*/
+        size_t arc_count = 0;
+        /*Número de laços, usado pelas subclasses não-direcionadas para contar arestas*/
+        size_t loop_count = 0;
+
+        /*Recalcula o número de arcos somando o tamanho das listas. Usado apenas nas verificações de depuração*/
+        size_t count_arcs() const {
+            size_t count = 0;
+            for (const auto& neighbors : adjac) {
+                count += neighbors.size();
+            }
+            return count;
+        }
+
+        /*Recalcula o número de laços. Usado apenas nas verificações de depuração*/
+        size_t count_loops() const {
+            size_t count = 0;
+            for (size_t i = 0; i < adjac.size(); ++i) {
+                count += std::count(adjac[i].begin(), adjac[i].end(), static_cast<int>(i));
+            }
+            return count;
+        }
+
+        /*Move o último nó (e a sua lista) para o índice liberado 'index' e descarta a última posição.
+          As referências ao último nó nas listas de vizinhos já devem ter sido renumeradas*/
+        void move_last_node_to(int index) {
+            size_t last_index = index_to_node.size() - 1;
+            node_to_index.erase(index_to_node[index]);
+            if (static_cast<size_t>(index) != last_index) {
+                adjac[index] = std::move(adjac[last_index]);
+                index_to_node[index] = std::move(index_to_node[last_index]);
+                node_to_index[index_to_node[index]] = index;
+            }
+            index_to_node.pop_back();
+            adjac.pop_back();
+        }
     public:
 
         /*Utiliza o mapeamento de índices para obter o número de vértices*/
@@ -25,13 +63,10 @@ class DirectedAdjacencyListGraph : public IGraph<Node> {
             return index_to_node.size();
         }
 
-        /*Calcula o número de arestas somando o tamanho das listas de adjacência*/
+        /*Retorna o contador de arcos em O(1). Em modo de depuração, confere o contador com as listas*/
         size_t get_size() const override {
-            size_t edge_count = 0;
-            for(const auto& neighbors : adjac) {
-                edge_count += neighbors.size();
-            }
-            return edge_count;
+            assert(arc_count == count_arcs() && "DirectedAdjacencyListGraph: arc counter out of sync");
+            return arc_count;
         }
 
         void add_node(const Node& node) override {
@@ -47,43 +82,107 @@ class DirectedAdjacencyListGraph : public IGraph<Node> {
             }
         }
 
+        /**
+         * @brief Remove um nó e todas as arestas ligadas a ele.
+         *
+         * Sem listas de entrada, todas as listas de vizinhos são percorridas para encontrar as
+         * arestas que chegam no nó, então cada remoção custa O(V + E). Para remover vários nós,
+         * use remove_nodes, que faz uma única passagem para o lote inteiro. Remoções individuais
+         * em O(grau) são oferecidas apenas por BidirectionalAdjacencyListGraph, que mantém as
+         * listas de entrada, e pelas subclasses não-direcionadas.
+         */
         void remove_node(const Node& node) override {
             auto it = node_to_index.find(node);
             /*Remove o nó apenas se ele existir*/
             if (it != node_to_index.end()) {
                 /*Obtém o índice do nó a ser removido*/
-                size_t index = it->second;
-                /*Obtém o índice do último nó para troca*/
-                size_t last_index = index_to_node.size() - 1;
+                int index = static_cast<int>(it->second);
+                /*Obtém o índice do último nó, que passará a ocupar o índice liberado*/
+                int last_index = static_cast<int>(index_to_node.size()) - 1;
+                /*Verifica se o nó possui laço antes de remover as suas arestas*/
+                bool has_loop = std::find(adjac[index].begin(), adjac[index].end(), index) != adjac[index].end();
 
-                /*Remove todas as arestas que apontam para o nó a ser removido*/
+                /*Sem listas de entrada, não há como saber quem aponta para o nó sem percorrer todas as listas.
+                  Numa única passagem, remove as arestas que chegam no nó e renumera as que chegam no último nó*/
                 for (auto& neighbors : adjac) {
-                    neighbors.erase(std::remove(neighbors.begin(), neighbors.end(), index), neighbors.end());
+                    size_t previous_size = neighbors.size();
+                    auto write = neighbors.begin();
+                    for (int neighbor_index : neighbors) {
+                        if (neighbor_index != index) {
+                            *write++ = neighbor_index == last_index ? index : neighbor_index;
+                        }
+                    }
+                    neighbors.erase(write, neighbors.end());
+                    arc_count -= previous_size - neighbors.size();
+                }
+                /*O laço do nó, se existia, foi removido acima junto com as arestas que chegam nele*/
+                if (has_loop) {
+                    loop_count--;
                 }
+                /*As arestas que saem do nó deixam de existir com a sua lista*/
+                arc_count -= adjac[index].size();
+
+                move_last_node_to(index);
+            }
+        }
 
-                /*Se o nó a ser removido não for o último, troca com o último para manter a sequência*/
-                if(index != last_index) {
-                    Node last_node = index_to_node[last_index];
-                    std::swap(index_to_node[index], index_to_node[last_index]);
-                    std::swap(adjac[index], adjac[last_index]);
-                    node_to_index[last_node] = index;
+        /**
+         * @brief Remove vários nós de uma só vez.
+         *
+         * Em vez de uma passagem por todas as listas a cada nó removido, as listas são compactadas
+         * uma única vez, em O(V + E) para o lote inteiro. Os nós restantes mantêm a sua ordem relativa.
+         * Nós que não existem no grafo são ignorados.
+         */
+        void remove_nodes(const std::vector<Node>& nodes) override {
+            /*Marca os nós removidos com -1 e numera os demais na ordem em que aparecem*/
+            std::vector<int> new_index(index_to_node.size(), 0);
+            bool any_removed = false;
+            for (const Node& node : nodes) {
+                auto it = node_to_index.find(node);
+                if (it != node_to_index.end()) {
+                    new_index[it->second] = -1;
+                    any_removed = true;
                 }
+            }
+            if (!any_removed) {
+                return;
+            }
+            int next_index = 0;
+            for (int& index : new_index) {
+                if (index != -1) {
+                    index = next_index++;
+                }
+            }
 
-                /*Atualiza os índices nas listas de adjacência para refletir a troca*/
-                for(auto& neighbors : adjac) {
-                    for(auto& neighbor_index : neighbors) {
-                        if(neighbor_index == static_cast<int>(last_index)) {
-                            neighbor_index = index;
-                        }
+            /*Compacta cada lista e a move para a sua nova posição, recontando arcos e laços*/
+            arc_count = 0;
+            loop_count = 0;
+            for (size_t i = 0; i < index_to_node.size(); ++i) {
+                if (new_index[i] == -1) {
+                    node_to_index.erase(index_to_node[i]);
+                    continue;
+                }
+                auto& neighbors = adjac[i];
+                auto write = neighbors.begin();
+                for (int neighbor_index : neighbors) {
+                    if (new_index[neighbor_index] != -1) {
+                        *write++ = new_index[neighbor_index];
                     }
                 }
+                neighbors.erase(write, neighbors.end());
+                arc_count += neighbors.size();
+                loop_count += std::count(neighbors.begin(), neighbors.end(), new_index[i]);
 
-                /*Remove o último nó (que é o nó a ser removido) e sua lista de vizinhos*/
-                index_to_node.pop_back();
-                adjac.pop_back();
-                node_to_index.erase(it);
-
+                /*Como new_index[i] <= i, a posição de destino já foi processada*/
+                size_t target = new_index[i];
+                if (target != i) {
+                    adjac[target] = std::move(neighbors);
+                    index_to_node[target] = std::move(index_to_node[i]);
+                }
+                node_to_index[index_to_node[target]] = target;
             }
+            adjac.resize(next_index);
+            index_to_node.resize(next_index);
         }
 
         void add_edge(const Node& from, const Node& to) override {
@@ -98,6 +197,10 @@ class DirectedAdjacencyListGraph : public IGraph<Node> {
             auto& neighbors_from = adjac[from_index];
             if (std::find(neighbors_from.begin(), neighbors_from.end(), to_index) == neighbors_from.end()) {
                 neighbors_from.push_back(to_index);
+                arc_count++;
+                if (from_index == to_index) {
+                    loop_count++;
+                }
             }
         }
 
@@ -111,11 +214,36 @@ class DirectedAdjacencyListGraph : public IGraph<Node> {
                 size_t to_index = it_to->second;
                 
                 auto& neighbors_from = adjac[from_index];
-                neighbors_from.erase(std::remove(neighbors_from.begin(), neighbors_from.end(), to_index), neighbors_from.end());
+                auto it = std::find(neighbors_from.begin(), neighbors_from.end(), to_index);
+                if (it != neighbors_from.end()) {
+                    neighbors_from.erase(it);
+                    arc_count--;
+                    if (from_index == to_index) {
+                        loop_count--;
+                    }
+                }
             }
 
         }
 
+        /**
+         * @brief Adiciona arcos já agrupados por origem e sem repetições.
+         *
+         * Com o grafo ainda sem arestas, as listas são copiadas diretamente, sem a busca por
+         * duplicatas de add_edge. Caso contrário, recorre à implementação padrão.
+         */
+        void add_adjacency(const std::vector<size_t>& offsets, const std::vector<int>& targets) override {
+            if (arc_count != 0 || offsets.size() != adjac.size() + 1) {
+                IGraph<Node>::add_adjacency(offsets, targets);
+                return;
+            }
+            for (size_t from_index = 0; from_index < adjac.size(); ++from_index) {
+                adjac[from_index].assign(targets.begin() + offsets[from_index], targets.begin() + offsets[from_index + 1]);
+                loop_count += std::count(adjac[from_index].begin(), adjac[from_index].end(), static_cast<int>(from_index));
+            }
+            arc_count = targets.size();
+        }
+
         std::vector<Node> get_neighbors(const Node& node) const override {
             auto it = node_to_index.find(node);
             /*Retorna uma lista vazia se o nó não existir*/
@@ -143,6 +271,20 @@ class DirectedAdjacencyListGraph : public IGraph<Node> {
             return adjac[index];
         }
 
+        bool for_each_neighbor(int index, NeighborVisitor visit) const override {
+            /*Caso o índice seja inválido, lança uma exceção*/
+            if (index < 0 || static_cast<size_t>(index) >= index_to_node.size()) {
+                throw std::out_of_range("for_each_neighbor: Index out of range");
+            }
+            /*Percorre a lista de vizinhos diretamente, sem copiá-la*/
+            for (int neighbor_index : adjac[index]) {
+                if (!visit(neighbor_index)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
         std::vector<Node> get_nodes() const override {
             /*Retorna todos os nós do grafo*/
             return index_to_node;
@@ -229,6 +371,10 @@ class DirectedAdjacencyListGraph : public IGraph<Node> {
             }
             return edges;
         }
+
+        bool is_directed() const override {
+            return true;
+        }
 };
 
 #endif // DIRECTEDADJACENCYLISTGRAPH_H
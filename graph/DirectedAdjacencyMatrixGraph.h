@@ -6,15 +6,18 @@
 #include <stdexcept>
 #include <unordered_map>
 #include <algorithm>
+#include <cassert>
 
 #include "IGraph.h"
+#include "NodeMap.h"
 
 /**
  * @class DirectedAdjacencyMatrixGraph
  * @brief Implementação de um grafo direcionado usando uma matriz de adjacência.
  * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
  */
-template<typename Node>
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
 class DirectedAdjacencyMatrixGraph : public IGraph<Node> {
 protected:
     // Matriz que armazena as adjacências (arestas) do grafo.
@@ -22,7 +25,33 @@ protected:
     // Vetor para mapear um índice ao seu nó correspondente.
     std::vector<Node> index_to_node;
     // Mapa para mapear um nó ao seu índice correspondente de forma eficiente.
-    std::unordered_map<Node, size_t> node_to_index;
+    NodeMap node_to_index;
+    // Número de células com valor 1, atualizado a cada inserção e remoção.
+    size_t arc_count = 0;
+    // Número de células da diagonal com valor 1 (laços).
+    size_t loop_count = 0;
+
+    /**
+     * @brief Recalcula o número de células com valor 1. Usado apenas nas verificações de depuração.
+     */
+    size_t count_arcs() const {
+        size_t count = 0;
+        for (const auto& row : matrix) {
+            count += std::count(row.begin(), row.end(), 1);
+        }
+        return count;
+    }
+
+    /**
+     * @brief Recalcula o número de laços. Usado apenas nas verificações de depuração.
+     */
+    size_t count_loops() const {
+        size_t count = 0;
+        for (size_t i = 0; i < matrix.size(); ++i) {
+            count += matrix[i][i] == 1 ? 1 : 0;
+        }
+        return count;
+    }
 
 public:
     /**
@@ -50,19 +79,14 @@ public:
 
     /**
      * @brief Retorna o número de arestas no grafo.
+     *
+     * O contador é mantido pelas operações de inserção e remoção, então a consulta custa O(1).
+     * Em modo de depuração, o contador é conferido com uma contagem completa da matriz.
      * @return O tamanho do grafo.
      */
     size_t get_size() const override {
-        size_t edge_count = 0;
-        // Percorre a matriz para contar as arestas (células com valor 1).
-        for (const auto& row : matrix) {
-            for (int val : row) {
-                if (val == 1) {
-                    edge_count++;
-                }
-            }
-        }
-        return edge_count;
+        assert(arc_count == count_arcs() && "DirectedAdjacencyMatrixGraph: arc counter out of sync");
+        return arc_count;
     }
 
     /**
@@ -109,6 +133,15 @@ public:
         size_t index_to_remove = node_to_index.at(node);
         size_t last_index = get_order() - 1;
 
+        // Desconta as arestas da linha e da coluna do nó; o laço pertence às duas e é descontado uma vez.
+        for (size_t i = 0; i < get_order(); ++i) {
+            arc_count -= static_cast<size_t>(matrix[index_to_remove][i] + matrix[i][index_to_remove]);
+        }
+        if (matrix[index_to_remove][index_to_remove] == 1) {
+            arc_count++;
+            loop_count--;
+        }
+
         // Para evitar redimensionamentos custosos, troca o nó a ser removido pelo último nó.
         if (index_to_remove != last_index) {
             // Troca as linhas e colunas na matriz.
@@ -126,7 +159,7 @@ public:
 
         Node last_node = index_to_node.back();
         node_to_index.erase(node);
-        index_to_node.erase(index_to_node.begin() + index_to_remove);
+        index_to_node.pop_back();
 
         // Atualiza os mapeamentos do nó que foi movido.
         if (index_to_remove != last_index) {
@@ -148,7 +181,13 @@ public:
         size_t from_idx = node_to_index.at(from);
         size_t to_idx = node_to_index.at(to);
 
-        matrix[from_idx][to_idx] = 1;
+        if (matrix[from_idx][to_idx] == 0) {
+            matrix[from_idx][to_idx] = 1;
+            arc_count++;
+            if (from_idx == to_idx) {
+                loop_count++;
+            }
+        }
     }
 
     /**
@@ -161,7 +200,13 @@ public:
             size_t from_idx = node_to_index.at(from);
             size_t to_idx = node_to_index.at(to);
             // Remove a marcação da aresta na matriz.
-            matrix[from_idx][to_idx] = 0;
+            if (matrix[from_idx][to_idx] == 1) {
+                matrix[from_idx][to_idx] = 0;
+                arc_count--;
+                if (from_idx == to_idx) {
+                    loop_count--;
+                }
+            }
         }
     }
 
@@ -270,13 +315,57 @@ public:
         }
 
         std::vector<int> neighbors_indices;
+        for_each_neighbor(index, [&](int neighbor_index) {
+            neighbors_indices.push_back(neighbor_index);
+        });
+        return neighbors_indices;
+    }
+
+    /**
+     * @brief Percorre os índices dos vizinhos de um nó sem alocar memória.
+     * @param index O índice do nó.
+     * @param visit A função chamada para cada vizinho.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    bool for_each_neighbor(int index, NeighborVisitor visit) const override {
+        if (index < 0 || static_cast<size_t>(index) >= get_order()) {
+            throw std::out_of_range("for_each_neighbor: Index out of range");
+        }
+
         // Percorre a linha da matriz para encontrar os índices dos vizinhos.
-        for (size_t j = 0; j < get_order(); ++j) {
-            if (matrix[index][j] == 1) {
-                neighbors_indices.push_back(j);
+        const std::vector<int>& row = matrix[index];
+        for (size_t j = 0; j < row.size(); ++j) {
+            if (row[j] == 1 && !visit(static_cast<int>(j))) {
+                return false;
             }
         }
-        return neighbors_indices;
+        return true;
+    }
+
+    /**
+     * @brief Percorre os índices dos nós com aresta chegando no nó, lendo a sua coluna da matriz.
+     * @param index O índice do nó.
+     * @param visit A função chamada para cada vizinho de entrada.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    bool for_each_in_neighbor(int index, NeighborVisitor visit) const override {
+        if (index < 0 || static_cast<size_t>(index) >= get_order()) {
+            throw std::out_of_range("for_each_in_neighbor: Index out of range");
+        }
+
+        for (size_t i = 0; i < get_order(); ++i) {
+            if (matrix[i][index] == 1 && !visit(static_cast<int>(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*A coluna do nó na matriz guarda as arestas de entrada*/
+    bool has_in_neighbor_access() const override {
+        return true;
     }
 
     /**
@@ -343,6 +432,10 @@ public:
         }
         return edges;
     }
+
+    bool is_directed() const override {
+        return true;
+    }
 };
 
 #endif
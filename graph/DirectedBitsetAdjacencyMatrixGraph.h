@@ -0,0 +1,512 @@
+#ifndef DIRECTEDBITSETADJACENCYMATRIXGRAPH_H
+#define DIRECTEDBITSETADJACENCYMATRIXGRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <stdexcept>
+#include <unordered_map>
+#include <algorithm>
+#include <cstdint>
+#include <cassert>
+
+#include "IGraph.h"
+#include "NodeMap.h"
+
+/**
+ * @class DirectedBitsetAdjacencyMatrixGraph
+ * @brief Implementação de um grafo direcionado usando uma matriz de adjacência compactada em bits.
+ * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
+ *
+ * Cada célula da matriz ocupa um único bit, e as linhas são armazenadas de forma contígua
+ * em palavras de 64 bits. Graus e tamanho são obtidos com popcount, e os vizinhos de um nó
+ * são percorridos palavra a palavra, saltando diretamente para o próximo bit ligado.
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class DirectedBitsetAdjacencyMatrixGraph : public IGraph<Node> {
+protected:
+    // Número de bits em cada palavra da matriz.
+    static constexpr size_t WORD_BITS = 64;
+
+    // Matriz de adjacência, linha a linha, com 'row_words' palavras por linha.
+    std::vector<uint64_t> bits;
+    // Número de palavras de cada linha (a capacidade de colunas é row_words * WORD_BITS).
+    size_t row_words = 0;
+    // Vetor para mapear um índice ao seu nó correspondente.
+    std::vector<Node> index_to_node;
+    // Mapa para mapear um nó ao seu índice correspondente de forma eficiente.
+    NodeMap node_to_index;
+    // Número de bits ligados, atualizado a cada inserção e remoção.
+    size_t arc_count = 0;
+    // Número de bits ligados na diagonal (laços).
+    size_t loop_count = 0;
+
+    /**
+     * @brief Retorna um ponteiro para a primeira palavra da linha de um nó.
+     */
+    uint64_t* row(size_t index) {
+        return bits.data() + index * row_words;
+    }
+
+    const uint64_t* row(size_t index) const {
+        return bits.data() + index * row_words;
+    }
+
+    /**
+     * @brief Verifica se o bit da célula (i, j) está ligado.
+     */
+    bool test(size_t i, size_t j) const {
+        return (row(i)[j / WORD_BITS] >> (j % WORD_BITS)) & 1u;
+    }
+
+    void set(size_t i, size_t j) {
+        row(i)[j / WORD_BITS] |= uint64_t{1} << (j % WORD_BITS);
+    }
+
+    void reset(size_t i, size_t j) {
+        row(i)[j / WORD_BITS] &= ~(uint64_t{1} << (j % WORD_BITS));
+    }
+
+    /**
+     * @brief Conta os bits ligados em uma linha da matriz.
+     */
+    size_t count_row(size_t index) const {
+        const uint64_t* words = row(index);
+        size_t count = 0;
+        for (size_t w = 0; w < row_words; ++w) {
+            count += static_cast<size_t>(__builtin_popcountll(words[w]));
+        }
+        return count;
+    }
+
+    /**
+     * @brief Garante espaço para 'columns' colunas, dobrando a largura das linhas quando necessário.
+     *
+     * Dobrar a largura faz com que a cópia da matriz aconteça apenas O(log V) vezes
+     * ao longo de inserções sucessivas de nós.
+     */
+    void reserve_columns(size_t columns) {
+        if (columns <= row_words * WORD_BITS) {
+            return;
+        }
+        size_t new_row_words = std::max<size_t>(1, row_words * 2);
+        while (new_row_words * WORD_BITS < columns) {
+            new_row_words *= 2;
+        }
+
+        std::vector<uint64_t> new_bits(get_order() * new_row_words, 0);
+        for (size_t i = 0; i < get_order(); ++i) {
+            std::copy(row(i), row(i) + row_words, new_bits.begin() + i * new_row_words);
+        }
+        bits.swap(new_bits);
+        row_words = new_row_words;
+    }
+
+    /**
+     * @brief Recalcula o número de bits ligados com popcount. Usado apenas nas verificações de depuração.
+     */
+    size_t count_arcs() const {
+        size_t count = 0;
+        for (uint64_t word : bits) {
+            count += static_cast<size_t>(__builtin_popcountll(word));
+        }
+        return count;
+    }
+
+    /**
+     * @brief Recalcula o número de laços. Usado apenas nas verificações de depuração.
+     */
+    size_t count_loops() const {
+        size_t count = 0;
+        for (size_t i = 0; i < get_order(); ++i) {
+            count += test(i, i) ? 1 : 0;
+        }
+        return count;
+    }
+
+public:
+    /**
+     * @brief Construtor padrão.
+     */
+    explicit DirectedBitsetAdjacencyMatrixGraph() = default;
+
+    /**
+     * @brief Construtor que inicializa o grafo com uma lista de nós.
+     * @param initial_nodes Um vetor de nós para popular o grafo.
+     */
+    explicit DirectedBitsetAdjacencyMatrixGraph(const std::vector<Node>& initial_nodes) {
+        reserve_columns(initial_nodes.size());
+        for (const auto& node : initial_nodes) {
+            add_node(node);
+        }
+    }
+
+    /**
+     * @brief Retorna o número de vértices (nós) no grafo.
+     * @return A ordem do grafo.
+     */
+    size_t get_order() const override {
+        return index_to_node.size();
+    }
+
+    /**
+     * @brief Retorna o número de arestas no grafo.
+     *
+     * O contador é mantido pelas operações de inserção e remoção, então a consulta custa O(1).
+     * @return O tamanho do grafo.
+     */
+    size_t get_size() const override {
+        assert(arc_count == count_arcs() && "DirectedBitsetAdjacencyMatrixGraph: arc counter out of sync");
+        return arc_count;
+    }
+
+    /**
+     * @brief Verifica se um nó existe no grafo.
+     * @param node O nó a ser verificado.
+     * @return true se o nó existe, false caso contrário.
+     */
+    bool has_node(const Node& node) const override {
+        return node_to_index.count(node) > 0;
+    }
+
+    /**
+     * @brief Adiciona um novo nó ao grafo.
+     * @param node O nó a ser adicionado.
+     */
+    void add_node(const Node& node) override {
+        // Se o nó já existe, não faz nada.
+        if (has_node(node)) {
+            return;
+        }
+
+        reserve_columns(get_order() + 1);
+
+        // Define o índice para o novo nó e acrescenta uma linha zerada.
+        size_t new_index = get_order();
+        node_to_index[node] = new_index;
+        index_to_node.push_back(node);
+        bits.resize(get_order() * row_words, 0);
+    }
+
+    /**
+     * @brief Remove um nó do grafo.
+     * @param node O nó a ser removido.
+     */
+    void remove_node(const Node& node) override {
+        if (!has_node(node)) {
+            throw std::runtime_error("Cannot remove node: node does not exist.");
+        }
+
+        size_t index_to_remove = node_to_index.at(node);
+        size_t last_index = get_order() - 1;
+
+        // Desconta as arestas da linha (popcount) e da coluna do nó; o laço é descontado uma vez.
+        arc_count -= count_row(index_to_remove);
+        for (size_t i = 0; i < get_order(); ++i) {
+            if (i != index_to_remove && test(i, index_to_remove)) {
+                arc_count--;
+            }
+        }
+        if (test(index_to_remove, index_to_remove)) {
+            loop_count--;
+        }
+
+        // Assim como na matriz de inteiros, o último nó ocupa o lugar do nó removido.
+        if (index_to_remove != last_index) {
+            std::copy(row(last_index), row(last_index) + row_words, row(index_to_remove));
+            for (size_t i = 0; i < last_index; ++i) {
+                if (test(i, last_index)) {
+                    set(i, index_to_remove);
+                } else {
+                    reset(i, index_to_remove);
+                }
+            }
+        }
+
+        // Remove a última linha e limpa a última coluna.
+        bits.resize(last_index * row_words);
+        for (size_t i = 0; i < last_index; ++i) {
+            reset(i, last_index);
+        }
+
+        Node last_node = index_to_node.back();
+        node_to_index.erase(node);
+        index_to_node.pop_back();
+
+        // Atualiza os mapeamentos do nó que foi movido.
+        if (index_to_remove != last_index) {
+            index_to_node[index_to_remove] = last_node;
+            node_to_index[last_node] = index_to_remove;
+        }
+    }
+
+    /**
+     * @brief Adiciona uma aresta direcionada de um nó de origem para um nó de destino.
+     * @param from O nó de origem.
+     * @param to O nó de destino.
+     */
+    void add_edge(const Node& from, const Node& to) override {
+        // Adiciona os nós se eles não existirem.
+        if (!has_node(from)) add_node(from);
+        if (!has_node(to)) add_node(to);
+
+        size_t from_idx = node_to_index.at(from);
+        size_t to_idx = node_to_index.at(to);
+        if (!test(from_idx, to_idx)) {
+            set(from_idx, to_idx);
+            arc_count++;
+            if (from_idx == to_idx) {
+                loop_count++;
+            }
+        }
+    }
+
+    /**
+     * @brief Remove uma aresta direcionada entre dois nós.
+     * @param from O nó de origem.
+     * @param to O nó de destino.
+     */
+    void remove_edge(const Node& from, const Node& to) override {
+        if (has_node(from) && has_node(to)) {
+            size_t from_idx = node_to_index.at(from);
+            size_t to_idx = node_to_index.at(to);
+            if (test(from_idx, to_idx)) {
+                reset(from_idx, to_idx);
+                arc_count--;
+                if (from_idx == to_idx) {
+                    loop_count--;
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Obtém os vizinhos de um determinado nó.
+     * @param node O nó para o qual os vizinhos serão retornados.
+     * @return Um vetor contendo os nós vizinhos.
+     */
+    std::vector<Node> get_neighbors(const Node& node) const override {
+        if (!has_node(node)) {
+            return {};
+        }
+
+        size_t node_idx = node_to_index.at(node);
+        std::vector<Node> neighbors;
+        neighbors.reserve(count_row(node_idx));
+        for_each_neighbor(static_cast<int>(node_idx), [&](int neighbor_index) {
+            neighbors.push_back(index_to_node[neighbor_index]);
+        });
+        return neighbors;
+    }
+
+    /**
+     * @brief Obtém todos os nós do grafo.
+     * @return Um vetor contendo todos os nós.
+     */
+    std::vector<Node> get_nodes() const override {
+        return index_to_node;
+    }
+
+    /**
+     * @brief Imprime uma representação visual do grafo no console.
+     */
+    void print() const override {
+        std::cout  << "Graph (" << (this->is_directed() ? "directed" : "undirected")
+                   << ", bitset, order: " << get_order()
+                   << ", size: " << this->get_size() << "):\n";
+
+        if (get_order() == 0) {
+            std::cout << "(Graph is empty)\n\n";
+            return;
+        }
+
+        std::cout << "\nAdjacency Matrix:\n";
+        std::cout << "    ";
+        for (const auto& node : index_to_node) {
+            std::cout << node << " ";
+        }
+        std::cout << "\n----";
+        for (size_t i = 0; i < get_order(); ++i) {
+            std::cout << "--";
+        }
+        std::cout << "\n";
+
+        for (size_t i = 0; i < get_order(); ++i) {
+            std::cout << index_to_node[i] << " | ";
+            for (size_t j = 0; j < get_order(); ++j) {
+                if (test(i, j)) {
+                    // Imprime arestas com cor para melhor visualização.
+                    std::cout << "\033[1;32m" << 1 << "\033[0m ";
+                } else {
+                    std::cout << 0 << " ";
+                }
+            }
+            std::cout << "\n";
+        }
+        std::cout << std::endl;
+    }
+
+    /**
+     * @brief Obtém o índice interno de um nó.
+     * @param node O nó cujo índice é desejado.
+     * @return O índice do nó, ou -1 se não existir.
+     */
+    int get_index(const Node& node) const override {
+        auto it = node_to_index.find(node);
+        if (it != node_to_index.end()) {
+            return it->second;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Obtém o nó correspondente a um índice.
+     * @param index O índice do nó.
+     * @return O nó correspondente.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    Node get_node(int index) const override {
+        if (index >= 0 && static_cast<size_t>(index) < index_to_node.size()) {
+            return index_to_node[index];
+        }
+        throw std::out_of_range("get_node: Index out of range");
+    }
+
+    /**
+     * @brief Obtém os índices dos vizinhos de um nó.
+     * @param index O índice do nó.
+     * @return Um vetor de inteiros com os índices dos vizinhos.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    std::vector<int> get_neighbors_indices(int index) const override {
+        if (index < 0 || static_cast<size_t>(index) >= get_order()) {
+            throw std::out_of_range("get_neighbors_indices: Index out of range");
+        }
+
+        std::vector<int> neighbors_indices;
+        neighbors_indices.reserve(count_row(index));
+        for_each_neighbor(index, [&](int neighbor_index) {
+            neighbors_indices.push_back(neighbor_index);
+        });
+        return neighbors_indices;
+    }
+
+    /**
+     * @brief Percorre os índices dos vizinhos de um nó sem alocar memória.
+     *
+     * Palavras vazias são puladas inteiras; em cada palavra não vazia, o próximo vizinho
+     * é o bit menos significativo ligado (ctz), que é então apagado da cópia local.
+     * @param index O índice do nó.
+     * @param visit A função chamada para cada vizinho.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    bool for_each_neighbor(int index, NeighborVisitor visit) const override {
+        if (index < 0 || static_cast<size_t>(index) >= get_order()) {
+            throw std::out_of_range("for_each_neighbor: Index out of range");
+        }
+
+        const uint64_t* words = row(index);
+        for (size_t w = 0; w < row_words; ++w) {
+            uint64_t word = words[w];
+            while (word != 0) {
+                int bit = __builtin_ctzll(word);
+                if (!visit(static_cast<int>(w * WORD_BITS) + bit)) {
+                    return false;
+                }
+                word &= word - 1;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Percorre os índices dos nós com aresta chegando no nó, testando o bit da sua coluna em cada linha.
+     * @param index O índice do nó.
+     * @param visit A função chamada para cada vizinho de entrada.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    bool for_each_in_neighbor(int index, NeighborVisitor visit) const override {
+        if (index < 0 || static_cast<size_t>(index) >= get_order()) {
+            throw std::out_of_range("for_each_in_neighbor: Index out of range");
+        }
+
+        for (size_t i = 0; i < get_order(); ++i) {
+            if (test(i, index) && !visit(static_cast<int>(i))) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*A coluna do nó na matriz guarda as arestas de entrada*/
+    bool has_in_neighbor_access() const override {
+        return true;
+    }
+
+    /**
+     * @brief Calcula o grau de entrada de um nó.
+     * @param node O nó para o qual o grau de entrada será calculado.
+     * @return O grau de entrada do nó.
+     */
+    size_t get_in_degree(const Node& node) const override {
+        if (!has_node(node)) {
+            return 0;
+        }
+        size_t node_idx = node_to_index.at(node);
+        size_t in_degree = 0;
+        // Percorre a coluna da matriz para contar as arestas que chegam ao nó.
+        for (size_t i = 0; i < get_order(); ++i) {
+            if (test(i, node_idx)) {
+                in_degree++;
+            }
+        }
+        return in_degree;
+    }
+
+    /**
+     * @brief Calcula o grau de saída de um nó.
+     * @param node O nó para o qual o grau de saída será calculado.
+     * @return O grau de saída do nó, obtido com popcount sobre a linha.
+     */
+    size_t get_out_degree(const Node& node) const override {
+        if (!has_node(node)) {
+            return 0;
+        }
+        return count_row(node_to_index.at(node));
+    }
+
+    /**
+     * @brief Verifica se um nó 'v' é adjacente a um nó 'u'.
+     * @param u O nó de origem.
+     * @param v O nó de destino.
+     * @return true se existe uma aresta de u para v, false caso contrário.
+     */
+    bool is_adjacent(const Node& u, const Node& v) const override {
+        int u_index = get_index(u);
+        int v_index = get_index(v);
+        if (u_index == -1 || v_index == -1) {
+            return false;
+        }
+        return test(u_index, v_index);
+    }
+
+    std::vector<EdgeIndex> get_all_edges() const override {
+        std::vector<EdgeIndex> edges;
+        edges.reserve(get_size());
+        // Percorre as linhas da matriz para coletar todas as arestas.
+        for (size_t from_index = 0; from_index < get_order(); from_index++) {
+            for_each_neighbor(static_cast<int>(from_index), [&](int to_index) {
+                edges.push_back(EdgeIndex{static_cast<int>(from_index), to_index});
+            });
+        }
+        return edges;
+    }
+
+    bool is_directed() const override {
+        return true;
+    }
+};
+
+#endif
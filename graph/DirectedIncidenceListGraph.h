@@ -0,0 +1,429 @@
+#ifndef DIRECTEDINCIDENCELISTGRAPH_H
+#define DIRECTEDINCIDENCELISTGRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <stdexcept>
+#include <functional>
+#include "IGraph.h"
+#include "NodeMap.h"
+
+/**
+ * @class DirectedIncidenceListGraph
+ * @brief Implementação esparsa de um grafo direcionado usando listas de incidência.
+ * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
+ *
+ * Em vez da matriz de incidência (arestas x vértices), as arestas ficam em um vetor indexado
+ * pelo identificador da aresta, e cada vértice guarda a lista de identificadores das arestas
+ * que saem dele e das que chegam nele. A memória ocupada é O(V + E), e percorrer os vizinhos
+ * de um nó custa apenas o seu grau.
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class DirectedIncidenceListGraph : public IGraph<Node> {
+protected:
+    // Vetor de arestas; a posição de cada aresta é o seu identificador.
+    std::vector<EdgeIndex> edges;
+    // Identificadores das arestas que saem de cada nó.
+    std::vector<std::vector<int>> out_edges;
+    // Identificadores das arestas que chegam em cada nó.
+    std::vector<std::vector<int>> in_edges;
+    // Vetor para mapear um índice ao seu nó correspondente.
+    std::vector<Node> index_to_node;
+    // Mapeia nós para seus índices.
+    NodeMap node_to_index;
+
+    /**
+     * @brief Substitui o identificador 'old_id' por 'new_id' em uma lista de incidência.
+     */
+    static void replace_edge_id(std::vector<int>& incident, int old_id, int new_id) {
+        auto it = std::find(incident.begin(), incident.end(), old_id);
+        if (it != incident.end()) {
+            *it = new_id;
+        }
+    }
+
+    /**
+     * @brief Remove o identificador 'edge_id' de uma lista de incidência, preservando a ordem.
+     */
+    static void erase_edge_id(std::vector<int>& incident, int edge_id) {
+        auto it = std::find(incident.begin(), incident.end(), edge_id);
+        if (it != incident.end()) {
+            incident.erase(it);
+        }
+    }
+
+    /**
+     * @brief Procura a aresta de 'from_index' para 'to_index'.
+     * @return O identificador da aresta, ou -1 caso ela não exista.
+     */
+    int find_edge(int from_index, int to_index) const {
+        for (int edge_id : out_edges[from_index]) {
+            if (edges[edge_id].to == to_index) {
+                return edge_id;
+            }
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Acrescenta uma aresta ao vetor de arestas e às listas de incidência dos extremos.
+     */
+    void append_edge(int from_index, int to_index) {
+        int edge_id = static_cast<int>(edges.size());
+        edges.push_back(EdgeIndex{from_index, to_index});
+        out_edges[from_index].push_back(edge_id);
+        in_edges[to_index].push_back(edge_id);
+    }
+
+    /**
+     * @brief Remove uma aresta a partir do seu identificador.
+     *
+     * A última aresta do vetor ocupa a posição liberada, de modo que apenas as listas dos
+     * extremos das duas arestas envolvidas precisam ser atualizadas.
+     */
+    void remove_edge_by_id(int edge_id) {
+        EdgeIndex removed = edges[edge_id];
+        erase_edge_id(out_edges[removed.from], edge_id);
+        erase_edge_id(in_edges[removed.to], edge_id);
+
+        int last_id = static_cast<int>(edges.size()) - 1;
+        if (edge_id != last_id) {
+            EdgeIndex moved = edges[last_id];
+            edges[edge_id] = moved;
+            replace_edge_id(out_edges[moved.from], last_id, edge_id);
+            replace_edge_id(in_edges[moved.to], last_id, edge_id);
+        }
+        edges.pop_back();
+    }
+
+public:
+    /**
+     * @brief Construtor padrão.
+     */
+    DirectedIncidenceListGraph() = default;
+
+    /**
+     * @brief Retorna o número de vértices no grafo.
+     * @return A ordem do grafo.
+     */
+    size_t get_order() const override { return index_to_node.size(); }
+
+    /**
+     * @brief Retorna o número de arestas no grafo.
+     * @return O tamanho do grafo.
+     */
+    size_t get_size() const override { return edges.size(); }
+
+    /**
+     * @brief Verifica se um nó existe no grafo.
+     * @param node O nó a ser verificado.
+     * @return true se o nó existe, false caso contrário.
+     */
+    bool has_node(const Node& node) const override {
+        return node_to_index.find(node) != node_to_index.end();
+    }
+
+    /**
+     * @brief Adiciona um novo nó ao grafo, com listas de incidência vazias.
+     * @param node O nó a ser adicionado.
+     */
+    void add_node(const Node& node) override {
+        if (!has_node(node)) {
+            node_to_index[node] = index_to_node.size();
+            index_to_node.push_back(node);
+            out_edges.emplace_back();
+            in_edges.emplace_back();
+        }
+    }
+
+    /**
+     * @brief Adiciona uma aresta direcionada de 'from' para 'to', caso ela ainda não exista.
+     * @param from O nó de origem.
+     * @param to O nó de destino.
+     */
+    void add_edge(const Node& from, const Node& to) override {
+        if (!has_node(from)) this->add_node(from);
+        if (!has_node(to)) this->add_node(to);
+
+        int from_index = static_cast<int>(node_to_index[from]);
+        int to_index = static_cast<int>(node_to_index[to]);
+        if (find_edge(from_index, to_index) == -1) {
+            append_edge(from_index, to_index);
+        }
+    }
+
+    /**
+     * @brief Adiciona arcos já agrupados por origem e sem repetições.
+     *
+     * Com o grafo ainda sem arestas, cada aresta é anexada diretamente, sem a busca por
+     * duplicatas de add_edge. Em grafos não-direcionados, cada aresta é guardada uma única
+     * vez, a partir do menor índice. Caso contrário, recorre à implementação padrão.
+     * @param offsets O início dos arcos de cada nó, com get_order() + 1 posições.
+     * @param targets Os índices de destino dos arcos.
+     */
+    void add_adjacency(const std::vector<size_t>& offsets, const std::vector<int>& targets) override {
+        if (!edges.empty() || offsets.size() != get_order() + 1) {
+            IGraph<Node>::add_adjacency(offsets, targets);
+            return;
+        }
+        bool directed = this->is_directed();
+        edges.reserve(directed ? targets.size() : (targets.size() + 1) / 2);
+        for (int from_index = 0; from_index < static_cast<int>(get_order()); ++from_index) {
+            for (size_t k = offsets[from_index]; k < offsets[from_index + 1]; ++k) {
+                if (directed || from_index <= targets[k]) {
+                    append_edge(from_index, targets[k]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Obtém todos os nós do grafo.
+     * @return Um vetor contendo todos os nós.
+     */
+    std::vector<Node> get_nodes() const override {
+        return index_to_node;
+    }
+
+    /**
+     * @brief Obtém o índice interno de um nó.
+     * @param node O nó.
+     * @return O índice do nó, ou -1 se não existir.
+     */
+    int get_index(const Node& node) const override {
+        auto it = node_to_index.find(node);
+        if (it != node_to_index.end()) {
+            return it->second;
+        }
+        return -1;
+    }
+
+    /**
+     * @brief Obtém o nó correspondente a um índice.
+     * @param index O índice do nó.
+     * @return O nó.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    Node get_node(int index) const override {
+        if (index >= 0 && static_cast<size_t>(index) < index_to_node.size()) {
+            return index_to_node[index];
+        }
+        throw std::out_of_range("get_node: Index out of range");
+    }
+
+    /**
+     * @brief Obtém os vizinhos de um nó.
+     * @param node O nó.
+     * @return Um vetor com os nós vizinhos.
+     */
+    std::vector<Node> get_neighbors(const Node& node) const override {
+        std::vector<Node> neighbors;
+        if (!has_node(node)) return neighbors;
+
+        this->for_each_neighbor(get_index(node), [&](int index) {
+            neighbors.push_back(index_to_node[index]);
+        });
+        return neighbors;
+    }
+
+    /**
+     * @brief Obtém os índices dos vizinhos de um nó.
+     * @param node_index O índice do nó.
+     * @return Um vetor com os índices dos vizinhos.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    std::vector<int> get_neighbors_indices(int node_index) const override {
+        std::vector<int> neighbors_indices;
+        this->for_each_neighbor(node_index, [&](int neighbor_index) {
+            neighbors_indices.push_back(neighbor_index);
+        });
+        return neighbors_indices;
+    }
+
+    /**
+     * @brief Percorre os índices dos vizinhos de um nó sem alocar memória.
+     *
+     * Cada aresta que sai do nó já guarda o seu destino, então o custo é o grau de saída.
+     * @param node_index O índice do nó.
+     * @param visit A função chamada para cada vizinho.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    bool for_each_neighbor(int node_index, NeighborVisitor visit) const override {
+        if (node_index < 0 || static_cast<size_t>(node_index) >= get_order()) {
+            throw std::out_of_range("for_each_neighbor: Index out of range");
+        }
+
+        for (int edge_id : out_edges[node_index]) {
+            if (!visit(edges[edge_id].to)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Percorre os índices dos nós com aresta chegando no nó, a partir da sua lista de entrada.
+     * @param node_index O índice do nó.
+     * @param visit A função chamada para cada vizinho de entrada.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    bool for_each_in_neighbor(int node_index, NeighborVisitor visit) const override {
+        if (node_index < 0 || static_cast<size_t>(node_index) >= get_order()) {
+            throw std::out_of_range("for_each_in_neighbor: Index out of range");
+        }
+
+        for (int edge_id : in_edges[node_index]) {
+            if (!visit(edges[edge_id].from)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /*As arestas de entrada de cada nó ficam em in_edges*/
+    bool has_in_neighbor_access() const override {
+        return true;
+    }
+
+    /**
+     * @brief Remove um nó e todas as arestas incidentes a ele.
+     *
+     * O último nó passa a ocupar o índice do nó removido, e apenas as arestas incidentes
+     * a esses dois nós são visitadas.
+     * @param node O nó a ser removido.
+     */
+    void remove_node(const Node& node) override {
+        if (!has_node(node)) return;
+
+        int index_to_remove = get_index(node);
+        int last_index = static_cast<int>(get_order()) - 1;
+
+        // Remove as arestas incidentes, da maior para a menor, para que a troca com a última
+        // aresta nunca mova uma aresta que ainda precisa ser removida.
+        std::vector<int> incident = out_edges[index_to_remove];
+        incident.insert(incident.end(), in_edges[index_to_remove].begin(), in_edges[index_to_remove].end());
+        std::sort(incident.begin(), incident.end(), std::greater<int>());
+        incident.erase(std::unique(incident.begin(), incident.end()), incident.end());
+        for (int edge_id : incident) {
+            remove_edge_by_id(edge_id);
+        }
+
+        // Move o último nó para o índice liberado, renomeando-o nas arestas incidentes a ele.
+        if (index_to_remove != last_index) {
+            for (int edge_id : out_edges[last_index]) {
+                edges[edge_id].from = index_to_remove;
+            }
+            for (int edge_id : in_edges[last_index]) {
+                edges[edge_id].to = index_to_remove;
+            }
+            out_edges[index_to_remove] = std::move(out_edges[last_index]);
+            in_edges[index_to_remove] = std::move(in_edges[last_index]);
+
+            Node last_node = index_to_node[last_index];
+            index_to_node[index_to_remove] = last_node;
+            node_to_index[last_node] = index_to_remove;
+        }
+
+        out_edges.pop_back();
+        in_edges.pop_back();
+        index_to_node.pop_back();
+        node_to_index.erase(node);
+    }
+
+    /**
+     * @brief Remove uma aresta direcionada entre dois nós.
+     * @param from O nó de origem.
+     * @param to O nó de destino.
+     */
+    void remove_edge(const Node& from, const Node& to) override {
+        if (!has_node(from) || !has_node(to)) return;
+
+        int edge_id = find_edge(get_index(from), get_index(to));
+        if (edge_id != -1) {
+            remove_edge_by_id(edge_id);
+        }
+    }
+
+    /**
+     * @brief Imprime as arestas do grafo e a lista de incidência de cada nó.
+     */
+    void print() const override {
+        bool directed = this->is_directed();
+        std::cout << "Graph (" << (directed ? "directed" : "undirected")
+                  << ", incidence list, order: " << get_order()
+                  << ", size: " << get_size() << "):\n";
+        if (get_order() == 0) {
+            std::cout << "(Graph is empty)\n\n";
+            return;
+        }
+
+        for (size_t i = 0; i < edges.size(); ++i) {
+            std::cout << " a" << i + 1 << ": " << index_to_node[edges[i].from]
+                      << (directed ? " -> " : " -- ") << index_to_node[edges[i].to] << "\n";
+        }
+        for (size_t i = 0; i < get_order(); ++i) {
+            std::cout << index_to_node[i] << ":";
+            for (int edge_id : out_edges[i]) {
+                std::cout << " a" << edge_id + 1;
+            }
+            for (int edge_id : in_edges[i]) {
+                // Em grafos não-direcionados, laços já aparecem na lista de saída.
+                if (directed || edges[edge_id].from != edges[edge_id].to) {
+                    std::cout << " a" << edge_id + 1;
+                }
+            }
+            std::cout << "\n";
+        }
+        std::cout << std::endl;
+    }
+
+    /**
+     * @brief Calcula o grau de entrada de um nó.
+     * @param node O nó.
+     * @return O grau de entrada.
+     */
+    size_t get_in_degree(const Node& node) const override {
+        int node_index = get_index(node);
+        return node_index == -1 ? 0 : in_edges[node_index].size();
+    }
+
+    /**
+     * @brief Calcula o grau de saída de um nó.
+     * @param node O nó.
+     * @return O grau de saída.
+     */
+    size_t get_out_degree(const Node& node) const override {
+        int node_index = get_index(node);
+        return node_index == -1 ? 0 : out_edges[node_index].size();
+    }
+
+    /**
+     * @brief Verifica se um nó 'v' é adjacente a 'u'.
+     * @param u O nó de origem.
+     * @param v O nó de destino.
+     * @return true se existe aresta de 'u' para 'v', false caso contrário.
+     */
+    bool is_adjacent(const Node& u, const Node& v) const override {
+        int u_idx = get_index(u);
+        int v_idx = get_index(v);
+        if (u_idx == -1 || v_idx == -1) {
+            return false;
+        }
+        return find_edge(u_idx, v_idx) != -1;
+    }
+
+    std::vector<EdgeIndex> get_all_edges() const override {
+        return edges;
+    }
+
+    bool is_directed() const override {
+        return true;
+    }
+};
+
+#endif
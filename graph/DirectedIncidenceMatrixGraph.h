@@ -3,25 +3,27 @@
 
 #include <iostream>
 #include <vector>
-#include <map>
+#include <unordered_map>
 #include <algorithm>
 #include <stdexcept>
 #include "IGraph.h"
+#include "NodeMap.h"
 
 /**
  * @class DirectedIncidenceMatrixGraph
  * @brief Implementação de um grafo direcionado usando uma matriz de incidência.
  * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
  */
-template<typename Node>
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
 class DirectedIncidenceMatrixGraph : public IGraph<Node> {
 protected:
     // Matriz de incidência (arestas x vértices).
     std::vector<std::vector<int>> matrix;
     // Mapeia nós para seus índices.
-    std::map<Node, size_t> node_to_index;
+    NodeMap node_to_index;
     // Mapeia índices para seus nós.
-    std::map<size_t, Node> index_to_node;
+    std::vector<Node> index_to_node;
 
 public:
     /**
@@ -33,7 +35,7 @@ public:
      * @brief Retorna o número de vértices no grafo.
      * @return A ordem do grafo.
      */
-    size_t get_order() const override { return node_to_index.size(); }
+    size_t get_order() const override { return index_to_node.size(); }
 
     /**
      * @brief Retorna o número de arestas no grafo.
@@ -58,7 +60,7 @@ public:
         if (!has_node(node)) {
             size_t index = this->get_order();
             node_to_index[node] = index;
-            index_to_node[index] = node;
+            index_to_node.push_back(node);
             // Adiciona uma nova coluna (representando o novo nó) a cada aresta existente.
             for (auto& edge_row : matrix) {
                 edge_row.push_back(0);
@@ -96,12 +98,7 @@ public:
      * @return Um vetor contendo todos os nós.
      */
     std::vector<Node> get_nodes() const override {
-        std::vector<Node> nodes;
-        nodes.reserve(this->get_order());
-        for(size_t i = 0; i < this->get_order(); ++i) {
-            nodes.push_back(index_to_node.at(i));
-        }
-        return nodes;
+        return index_to_node;
     }
 
     /**
@@ -123,8 +120,8 @@ public:
      * @throws std::out_of_range se o índice for inválido.
      */
     Node get_node(int index) const override {
-        if (index_to_node.count(index)) {
-            return index_to_node.at(index);
+        if (index >= 0 && static_cast<size_t>(index) < index_to_node.size()) {
+            return index_to_node[index];
         }
         throw std::out_of_range("Indice fora do intervalo.");
     }
@@ -138,10 +135,9 @@ public:
         std::vector<Node> neighbors;
         if (!has_node(node)) return neighbors;
 
-        auto indices = get_neighbors_indices(get_index(node));
-        for(int index : indices) {
-            neighbors.push_back(get_node(index));
-        }
+        this->for_each_neighbor(get_index(node), [&](int index) {
+            neighbors.push_back(index_to_node[index]);
+        });
         return neighbors;
     }
 
@@ -152,7 +148,20 @@ public:
      */
     std::vector<int> get_neighbors_indices(int node_index) const override {
         std::vector<int> neighbors_indices;
-        if (node_index < 0 || node_index >= static_cast<int>(this->get_order())) return neighbors_indices;
+        this->for_each_neighbor(node_index, [&](int neighbor_index) {
+            neighbors_indices.push_back(neighbor_index);
+        });
+        return neighbors_indices;
+    }
+
+    /**
+     * @brief Percorre os índices dos vizinhos de um nó sem alocar memória.
+     * @param node_index O índice do nó.
+     * @param visit A função chamada para cada vizinho.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     */
+    bool for_each_neighbor(int node_index, NeighborVisitor visit) const override {
+        if (node_index < 0 || node_index >= static_cast<int>(this->get_order())) return true;
 
         // Percorre cada aresta (linha) da matriz.
         for (const auto& edge_row : matrix) {
@@ -161,13 +170,41 @@ public:
                 // Procura pelo destino da mesma aresta (1).
                 for (size_t i = 0; i < this->get_order(); ++i) {
                     if (edge_row[i] == 1) {
-                        neighbors_indices.push_back(i);
+                        if (!visit(static_cast<int>(i))) {
+                            return false;
+                        }
                         break; // Passa para a próxima aresta.
                     }
                 }
             }
         }
-        return neighbors_indices;
+        return true;
+    }
+
+    /**
+     * @brief Percorre os índices dos nós com aresta chegando no nó.
+     * @param node_index O índice do nó.
+     * @param visit A função chamada para cada vizinho de entrada.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     */
+    bool for_each_in_neighbor(int node_index, NeighborVisitor visit) const override {
+        if (node_index < 0 || node_index >= static_cast<int>(this->get_order())) return true;
+
+        // Percorre cada aresta (linha) da matriz.
+        for (const auto& edge_row : matrix) {
+            // Se o nó atual for o destino da aresta (1), procura pela origem (-1).
+            if (edge_row[node_index] == 1) {
+                for (size_t i = 0; i < this->get_order(); ++i) {
+                    if (edge_row[i] == -1) {
+                        if (!visit(static_cast<int>(i))) {
+                            return false;
+                        }
+                        break;
+                    }
+                }
+            }
+        }
+        return true;
     }
 
     /**
@@ -191,16 +228,13 @@ public:
         }
 
         // Remove o nó dos mapeamentos.
-        index_to_node.erase(index_to_remove);
+        index_to_node.erase(index_to_node.begin() + index_to_remove);
         node_to_index.erase(node);
 
         // Reajusta os índices dos nós subsequentes para manter a consistência.
         for (size_t i = index_to_remove; i < get_order(); ++i) {
-            Node n = index_to_node.at(i + 1);
-            index_to_node[i] = n;
-            node_to_index[n] = i;
+            node_to_index[index_to_node[i]] = i;
         }
-        index_to_node.erase(get_order());
     }
 
     /**
@@ -234,7 +268,7 @@ public:
 
         std::cout << "    |";
         for (size_t i = 0; i < this->get_order(); ++i) {
-            std::cout << " " << index_to_node.at(i) << " ";
+            std::cout << " " << index_to_node[i] << " ";
         }
         std::cout << "\n----|";
         for (size_t i = 0; i < this->get_order(); ++i) {
@@ -335,6 +369,10 @@ public:
         }
         return edges;
     }
+
+    bool is_directed() const override {
+        return true;
+    }
 };
 
 #endif
@@ -0,0 +1,417 @@
+#ifndef DIRECTEDWEIGHTEDADJACENCYLISTGRAPH_H
+#define DIRECTEDWEIGHTEDADJACENCYLISTGRAPH_H
+
+#include <iostream>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <stdexcept>
+#include <cassert>
+
+#include "IWeightedGraph.h"
+#include "NodeMap.h"
+
+/* Implementação de um grafo dirigido e ponderado usando listas de adjacência,
+   em que cada vizinho é armazenado junto com o peso da aresta */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class DirectedWeightedAdjacencyListGraph : public IWeightedGraph<Node> {
+    protected:
+        /*Armazena vizinhos de cada nó, com o peso da aresta até cada um deles*/
+        std::vector<std::vector<WeightedNeighbor>> adjac;
+        /*Armazena nós por índice*/
+        std::vector<Node> index_to_node;
+        /*Mapeia nós para seus índices*/
+        NodeMap node_to_index;
+        /*Número de arcos armazenados nas listas, atualizado a cada inserção e remoção*/
+        size_t arc_count = 0;
+        /*Número de laços, usado pela subclasse não-direcionada para contar arestas*/
+        size_t loop_count = 0;
+
+        /*Recalcula o número de arcos somando o tamanho das listas. Usado apenas nas verificações de depuração*/
+        size_t count_arcs() const {
+            size_t count = 0;
+            for (const auto& neighbors : adjac) {
+                count += neighbors.size();
+            }
+            return count;
+        }
+
+        /*Recalcula o número de laços. Usado apenas nas verificações de depuração*/
+        size_t count_loops() const {
+            size_t count = 0;
+            for (size_t i = 0; i < adjac.size(); ++i) {
+                for (const WeightedNeighbor& neighbor : adjac[i]) {
+                    count += neighbor.index == static_cast<int>(i) ? 1 : 0;
+                }
+            }
+            return count;
+        }
+
+        /*Registra um novo arco nos contadores*/
+        void count_added_arc(size_t from_index, int to_index) {
+            arc_count++;
+            if (static_cast<int>(from_index) == to_index) {
+                loop_count++;
+            }
+        }
+
+        /*Move o último nó (e a sua lista) para o índice liberado 'index' e descarta a última posição.
+          As referências ao último nó nas listas de vizinhos já devem ter sido renumeradas*/
+        void move_last_node_to(int index) {
+            size_t last_index = index_to_node.size() - 1;
+            node_to_index.erase(index_to_node[index]);
+            if (static_cast<size_t>(index) != last_index) {
+                adjac[index] = std::move(adjac[last_index]);
+                index_to_node[index] = std::move(index_to_node[last_index]);
+                node_to_index[index_to_node[index]] = index;
+            }
+            index_to_node.pop_back();
+            adjac.pop_back();
+        }
+
+        /*Procura o vizinho 'to_index' na lista do nó 'from_index'. Retorna nullptr caso não exista*/
+        WeightedNeighbor* find_neighbor(size_t from_index, int to_index) {
+            auto& neighbors = adjac[from_index];
+            auto it = std::find_if(neighbors.begin(), neighbors.end(),
+                [to_index](const WeightedNeighbor& neighbor) { return neighbor.index == to_index; });
+            return it == neighbors.end() ? nullptr : &*it;
+        }
+
+        const WeightedNeighbor* find_neighbor(size_t from_index, int to_index) const {
+            return const_cast<DirectedWeightedAdjacencyListGraph*>(this)->find_neighbor(from_index, to_index);
+        }
+
+    public:
+        using IWeightedGraph<Node>::add_edge;
+
+        /*Utiliza o mapeamento de índices para obter o número de vértices*/
+        size_t get_order() const override {
+            return index_to_node.size();
+        }
+
+        /*Retorna o contador de arcos em O(1). Em modo de depuração, confere o contador com as listas*/
+        size_t get_size() const override {
+            assert(arc_count == count_arcs() && "DirectedWeightedAdjacencyListGraph: arc counter out of sync");
+            return arc_count;
+        }
+
+        void add_node(const Node& node) override {
+            /*Adiciona nó apenas se ele não existir*/
+            if (node_to_index.find(node) == node_to_index.end()) {
+                node_to_index[node] = index_to_node.size();
+                index_to_node.push_back(node);
+                adjac.emplace_back();
+            }
+        }
+
+        /**
+         * @brief Remove um nó e todas as arestas ligadas a ele.
+         *
+         * Sem listas de entrada, todas as listas de vizinhos são percorridas para encontrar as
+         * arestas que chegam no nó, então cada remoção custa O(V + E). Para remover vários nós,
+         * use remove_nodes, que faz uma única passagem para o lote inteiro. Não há versão
+         * ponderada de BidirectionalAdjacencyListGraph; apenas a subclasse não-direcionada, em
+         * que as listas são simétricas, remove um nó visitando somente as vizinhanças afetadas.
+         */
+        void remove_node(const Node& node) override {
+            auto it = node_to_index.find(node);
+            /*Remove o nó apenas se ele existir*/
+            if (it == node_to_index.end()) {
+                return;
+            }
+
+            int index = it->second;
+            int last_index = index_to_node.size() - 1;
+            if (find_neighbor(index, index) != nullptr) {
+                loop_count--;
+            }
+
+            /*Numa única passagem, remove as arestas que chegam no nó e renumera as que chegam no último nó,
+              que passará a ocupar o índice liberado*/
+            for (auto& neighbors : adjac) {
+                size_t previous_size = neighbors.size();
+                auto write = neighbors.begin();
+                for (const WeightedNeighbor& neighbor : neighbors) {
+                    if (neighbor.index != index) {
+                        *write++ = WeightedNeighbor{neighbor.index == last_index ? index : neighbor.index, neighbor.weight};
+                    }
+                }
+                neighbors.erase(write, neighbors.end());
+                arc_count -= previous_size - neighbors.size();
+            }
+            /*As arestas que saem do nó deixam de existir com a sua lista*/
+            arc_count -= adjac[index].size();
+
+            move_last_node_to(index);
+        }
+
+        /*Remove vários nós de uma só vez, compactando as listas uma única vez (O(V + E) para o lote inteiro).
+          Os nós restantes mantêm a sua ordem relativa, e nós que não existem são ignorados*/
+        void remove_nodes(const std::vector<Node>& nodes) override {
+            std::vector<int> new_index(index_to_node.size(), 0);
+            bool any_removed = false;
+            for (const Node& node : nodes) {
+                auto it = node_to_index.find(node);
+                if (it != node_to_index.end()) {
+                    new_index[it->second] = -1;
+                    any_removed = true;
+                }
+            }
+            if (!any_removed) {
+                return;
+            }
+            int next_index = 0;
+            for (int& index : new_index) {
+                if (index != -1) {
+                    index = next_index++;
+                }
+            }
+
+            arc_count = 0;
+            loop_count = 0;
+            for (size_t i = 0; i < index_to_node.size(); ++i) {
+                if (new_index[i] == -1) {
+                    node_to_index.erase(index_to_node[i]);
+                    continue;
+                }
+                auto& neighbors = adjac[i];
+                auto write = neighbors.begin();
+                for (const WeightedNeighbor& neighbor : neighbors) {
+                    if (new_index[neighbor.index] != -1) {
+                        *write++ = WeightedNeighbor{new_index[neighbor.index], neighbor.weight};
+                    }
+                }
+                neighbors.erase(write, neighbors.end());
+                arc_count += neighbors.size();
+                for (const WeightedNeighbor& neighbor : neighbors) {
+                    loop_count += neighbor.index == new_index[i] ? 1 : 0;
+                }
+
+                /*Como new_index[i] <= i, a posição de destino já foi processada*/
+                size_t target = new_index[i];
+                if (target != i) {
+                    adjac[target] = std::move(neighbors);
+                    index_to_node[target] = std::move(index_to_node[i]);
+                }
+                node_to_index[index_to_node[target]] = target;
+            }
+            adjac.resize(next_index);
+            index_to_node.resize(next_index);
+        }
+
+        /*Adiciona uma aresta de peso unitário, caso ela ainda não exista*/
+        void add_edge(const Node& from, const Node& to) override {
+            add_node(from);
+            add_node(to);
+
+            size_t from_index = node_to_index[from];
+            int to_index = node_to_index[to];
+            if (find_neighbor(from_index, to_index) == nullptr) {
+                adjac[from_index].push_back(WeightedNeighbor{to_index, 1.0});
+                count_added_arc(from_index, to_index);
+            }
+        }
+
+        void add_edge(const Node& from, const Node& to, double weight) override {
+            add_node(from);
+            add_node(to);
+
+            size_t from_index = node_to_index[from];
+            int to_index = node_to_index[to];
+
+            /*Se a aresta já existir, apenas atualiza o seu peso*/
+            WeightedNeighbor* neighbor = find_neighbor(from_index, to_index);
+            if (neighbor != nullptr) {
+                neighbor->weight = weight;
+            } else {
+                adjac[from_index].push_back(WeightedNeighbor{to_index, weight});
+                count_added_arc(from_index, to_index);
+            }
+        }
+
+        /*Adiciona arcos já agrupados por origem e sem repetições. Com o grafo ainda sem arestas,
+          as listas são preenchidas diretamente, sem a busca por duplicatas de add_edge*/
+        void add_weighted_adjacency(const std::vector<size_t>& offsets, const std::vector<int>& targets,
+                                    const std::vector<double>& weights) override {
+            if (arc_count != 0 || offsets.size() != adjac.size() + 1) {
+                IWeightedGraph<Node>::add_weighted_adjacency(offsets, targets, weights);
+                return;
+            }
+            for (size_t from_index = 0; from_index < adjac.size(); ++from_index) {
+                auto& neighbors = adjac[from_index];
+                neighbors.reserve(offsets[from_index + 1] - offsets[from_index]);
+                for (size_t k = offsets[from_index]; k < offsets[from_index + 1]; ++k) {
+                    neighbors.push_back(WeightedNeighbor{targets[k], weights[k]});
+                    count_added_arc(from_index, targets[k]);
+                }
+            }
+        }
+
+        /*Sem pesos, os arcos recebem peso unitário*/
+        void add_adjacency(const std::vector<size_t>& offsets, const std::vector<int>& targets) override {
+            add_weighted_adjacency(offsets, targets, std::vector<double>(targets.size(), 1.0));
+        }
+
+        void remove_edge(const Node& from, const Node& to) override {
+            auto it_from = node_to_index.find(from);
+            auto it_to = node_to_index.find(to);
+
+            /*Remove o vizinho da lista do nó origem, se ambos existirem*/
+            if (it_from != node_to_index.end() && it_to != node_to_index.end()) {
+                int from_index = it_from->second;
+                int to_index = it_to->second;
+                auto& neighbors = adjac[from_index];
+                auto it = std::find_if(neighbors.begin(), neighbors.end(),
+                    [to_index](const WeightedNeighbor& neighbor) { return neighbor.index == to_index; });
+                if (it != neighbors.end()) {
+                    neighbors.erase(it);
+                    arc_count--;
+                    if (from_index == to_index) {
+                        loop_count--;
+                    }
+                }
+            }
+        }
+
+        std::vector<Node> get_neighbors(const Node& node) const override {
+            auto it = node_to_index.find(node);
+            if (it == node_to_index.end()) {
+                return {};
+            }
+
+            std::vector<Node> neighbors;
+            neighbors.reserve(adjac[it->second].size());
+            for (const WeightedNeighbor& neighbor : adjac[it->second]) {
+                neighbors.push_back(index_to_node[neighbor.index]);
+            }
+            return neighbors;
+        }
+
+        std::vector<int> get_neighbors_indices(int index) const override {
+            if (index < 0 || static_cast<size_t>(index) >= index_to_node.size()) {
+                throw std::out_of_range("get_neighbors_indices: Index out of range");
+            }
+            std::vector<int> neighbors;
+            neighbors.reserve(adjac[index].size());
+            for (const WeightedNeighbor& neighbor : adjac[index]) {
+                neighbors.push_back(neighbor.index);
+            }
+            return neighbors;
+        }
+
+        bool for_each_neighbor(int index, NeighborVisitor visit) const override {
+            if (index < 0 || static_cast<size_t>(index) >= index_to_node.size()) {
+                throw std::out_of_range("for_each_neighbor: Index out of range");
+            }
+            for (const WeightedNeighbor& neighbor : adjac[index]) {
+                if (!visit(neighbor.index)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        bool for_each_weighted_neighbor(int index, WeightedNeighborVisitor visit) const override {
+            if (index < 0 || static_cast<size_t>(index) >= index_to_node.size()) {
+                throw std::out_of_range("for_each_weighted_neighbor: Index out of range");
+            }
+            for (const WeightedNeighbor& neighbor : adjac[index]) {
+                if (!visit(neighbor.index, neighbor.weight)) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        double get_weight(int from_index, int to_index) const override {
+            if (from_index < 0 || static_cast<size_t>(from_index) >= index_to_node.size()) {
+                throw std::out_of_range("get_weight: Index out of range");
+            }
+            const WeightedNeighbor* neighbor = find_neighbor(from_index, to_index);
+            return neighbor != nullptr ? neighbor->weight : std::numeric_limits<double>::infinity();
+        }
+
+        std::vector<Node> get_nodes() const override {
+            return index_to_node;
+        }
+
+        bool has_node(const Node& node) const override {
+            return node_to_index.find(node) != node_to_index.end();
+        }
+
+        /*Imprime o grafo no formato de lista de adjacência, com o peso de cada aresta entre parênteses*/
+        void print() const override {
+            std::cout << "Weighted graph (order: " << get_order() << ", size: " << this->get_size() << "):\n";
+            for (size_t i = 0; i < index_to_node.size(); ++i) {
+                std::cout << index_to_node[i] << ": ";
+                for (const WeightedNeighbor& neighbor : adjac[i]) {
+                    std::cout << index_to_node[neighbor.index] << "(" << neighbor.weight << ") ";
+                }
+                std::cout << "\n";
+            }
+            std::cout << std::endl;
+        }
+
+        int get_index(const Node& node) const override {
+            auto it = node_to_index.find(node);
+            if (it != node_to_index.end()) {
+                return it->second;
+            }
+            return -1;
+        }
+
+        Node get_node(int index) const override {
+            if (index >= 0 && static_cast<size_t>(index) < index_to_node.size()) {
+                return index_to_node[index];
+            }
+            throw std::out_of_range("get_node: Index out of range");
+        }
+
+        size_t get_in_degree(const Node& node) const override {
+            int node_index = get_index(node);
+            if (node_index == -1) {
+                return 0;
+            }
+
+            /*Conta quantos nós apontam para o nó*/
+            size_t in_degree = 0;
+            for (const auto& neighbors : adjac) {
+                for (const WeightedNeighbor& neighbor : neighbors) {
+                    if (neighbor.index == node_index) {
+                        in_degree++;
+                    }
+                }
+            }
+            return in_degree;
+        }
+
+        size_t get_out_degree(const Node& node) const override {
+            int node_index = get_index(node);
+            return node_index == -1 ? 0 : adjac[node_index].size();
+        }
+
+        bool is_adjacent(const Node& u, const Node& v) const override {
+            int u_index = get_index(u);
+            int v_index = get_index(v);
+            if (u_index == -1 || v_index == -1) {
+                return false;
+            }
+            return find_neighbor(u_index, v_index) != nullptr;
+        }
+
+        std::vector<EdgeIndex> get_all_edges() const override {
+            std::vector<EdgeIndex> edges;
+            for (size_t from_index = 0; from_index < adjac.size(); from_index++) {
+                for (const WeightedNeighbor& neighbor : adjac[from_index]) {
+                    edges.push_back(EdgeIndex{static_cast<int>(from_index), neighbor.index});
+                }
+            }
+            return edges;
+        }
+
+        bool is_directed() const override {
+            return true;
+        }
+};
+
+#endif // DIRECTEDWEIGHTEDADJACENCYLISTGRAPH_H
@@ -0,0 +1,439 @@
+#ifndef GRAPHBUILDER_H
+#define GRAPHBUILDER_H
+
+#include <vector>
+#include <unordered_map>
+#include <stdexcept>
+#include <cstddef>
+#include <cmath>
+#include <limits>
+#include <algorithm>
+#include <thread>
+#include <exception>
+
+#include "IWeightedGraph.h"
+#include "NodeMap.h"
+
+/**
+ * @struct AdjacencyArrays
+ * @brief Arcos de um grafo agrupados por nó de origem, no formato CSR.
+ *
+ * Os destinos dos arcos que saem do nó de índice i estão em
+ * targets[offsets[i]] .. targets[offsets[i + 1] - 1]. O vetor de pesos, quando não está
+ * vazio, é paralelo ao de destinos. Em grafos não-direcionados, cada aresta aparece nos
+ * dois sentidos (laços aparecem uma única vez).
+ */
+struct AdjacencyArrays {
+    std::vector<size_t> offsets;
+    std::vector<int> targets;
+    std::vector<double> weights;
+};
+
+/**
+ * @brief Agrupa uma lista de arestas por nó de origem e descarta as repetidas, em O(V + E).
+ *
+ * Os arcos são distribuídos por origem com uma ordenação por contagem estável (uma ordenação
+ * radix de um único dígito, de base igual à ordem do grafo), preservando a ordem em que
+ * aparecem na lista. As repetições são descartadas com um vetor de marcação por destino, sem
+ * buscas nas listas; em grafos ponderados, prevalece o último peso informado para o arco.
+ * Um peso NaN indica um arco registrado sem peso: ele não substitui um peso já informado e,
+ * se nenhum peso for informado, o arco recebe peso 1 (como em add_edge sem peso).
+ * O resultado é o mesmo de uma sequência de chamadas a add_edge, sem o custo quadrático da
+ * verificação de duplicatas em nós de grau alto.
+ *
+ * @param order O número de nós do grafo.
+ * @param sources Os índices de origem das arestas.
+ * @param targets Os índices de destino das arestas, paralelo a 'sources'.
+ * @param weights Os pesos das arestas, paralelo a 'sources', ou vazio para arestas sem peso.
+ * @param directed Indica se as arestas são direcionadas.
+ * @return Os arcos agrupados por origem e sem repetições.
+ * @throws std::out_of_range se alguma aresta referenciar um índice inválido.
+ */
+inline AdjacencyArrays group_arcs(size_t order, const std::vector<int>& sources,
+                                  const std::vector<int>& targets, const std::vector<double>& weights,
+                                  bool directed) {
+    bool weighted = !weights.empty();
+    size_t edge_count = sources.size();
+
+    // Conta os arcos de cada origem; em grafos não-direcionados, cada aresta comum gera dois arcos.
+    std::vector<size_t> counts(order + 1, 0);
+    for (size_t e = 0; e < edge_count; ++e) {
+        int from = sources[e];
+        int to = targets[e];
+        if (from < 0 || to < 0 || static_cast<size_t>(from) >= order || static_cast<size_t>(to) >= order) {
+            throw std::out_of_range("group_arcs: edge index out of range");
+        }
+        counts[from + 1]++;
+        if (!directed && from != to) {
+            counts[to + 1]++;
+        }
+    }
+    for (size_t i = 0; i < order; ++i) {
+        counts[i + 1] += counts[i];
+    }
+
+    // Distribui os arcos mantendo a ordem relativa dentro de cada origem.
+    std::vector<int> sorted_targets(counts[order]);
+    std::vector<double> sorted_weights(weighted ? counts[order] : 0);
+    std::vector<size_t> position(counts.begin(), counts.end() - 1);
+    for (size_t e = 0; e < edge_count; ++e) {
+        int from = sources[e];
+        int to = targets[e];
+        size_t k = position[from]++;
+        sorted_targets[k] = to;
+        if (weighted) {
+            sorted_weights[k] = weights[e];
+        }
+        if (!directed && from != to) {
+            k = position[to]++;
+            sorted_targets[k] = from;
+            if (weighted) {
+                sorted_weights[k] = weights[e];
+            }
+        }
+    }
+
+    // Remove arcos repetidos. last_seen[v] guarda a última origem em que v apareceu e
+    // slot[v] a posição em que v foi armazenado nessa origem.
+    AdjacencyArrays result;
+    std::vector<int> last_seen(order, -1);
+    std::vector<size_t> slot(order, 0);
+    result.offsets.assign(order + 1, 0);
+    result.targets.reserve(sorted_targets.size());
+    if (weighted) {
+        result.weights.reserve(sorted_targets.size());
+    }
+    for (size_t from = 0; from < order; ++from) {
+        for (size_t k = counts[from]; k < counts[from + 1]; ++k) {
+            int to = sorted_targets[k];
+            if (last_seen[to] != static_cast<int>(from)) {
+                last_seen[to] = static_cast<int>(from);
+                slot[to] = result.targets.size();
+                result.targets.push_back(to);
+                if (weighted) {
+                    result.weights.push_back(sorted_weights[k]);
+                }
+            } else if (weighted && !std::isnan(sorted_weights[k])) {
+                result.weights[slot[to]] = sorted_weights[k];
+            }
+        }
+        result.offsets[from + 1] = result.targets.size();
+    }
+    for (double& weight : result.weights) {
+        if (std::isnan(weight)) {
+            weight = 1.0;
+        }
+    }
+    result.targets.shrink_to_fit();
+    result.weights.shrink_to_fit();
+    return result;
+}
+
+/**
+ * @struct EdgeIndexBlock
+ * @brief Um lote de arestas já convertidas para índices de um GraphBuilder.
+ *
+ * É o formato produzido por cada thread dos leitores paralelos de arquivos (veja
+ * GraphBuilder::append_edge_blocks). O vetor de pesos é paralelo ao de origens, com NaN nas
+ * arestas sem peso, ou vazio se nenhuma aresta do lote tem peso.
+ */
+struct EdgeIndexBlock {
+    std::vector<int> sources;
+    std::vector<int> targets;
+    std::vector<double> weights;
+};
+
+/**
+ * @class GraphBuilder
+ * @brief Acumula arestas em lote e constrói qualquer representação de grafo de uma só vez.
+ * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices no construtor (veja NodeMap.h).
+ *
+ * Popular um grafo com uma chamada a add_edge por aresta faz cada representação verificar
+ * duplicatas a cada inserção, o que custa O(d²) para um nó de grau d nas listas de adjacência.
+ * O construtor apenas registra as arestas; ao final, group_arcs agrupa e remove as repetidas
+ * uma única vez, e o resultado é entregue ao grafo de destino por add_adjacency, que as
+ * representações do repositório implementam sem novas verificações.
+ *
+ * Os nós recebem índices na ordem em que aparecem pela primeira vez (ou na ordem de add_node).
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class GraphBuilder {
+    // Nós registrados, na ordem dos índices.
+    std::vector<Node> nodes;
+    // Mapeia nós para seus índices no construtor.
+    NodeMap node_to_index;
+    // Origens, destinos e pesos das arestas registradas, em ordem de inserção.
+    std::vector<int> sources;
+    std::vector<int> targets;
+    std::vector<double> weights;
+    // Indica se as arestas são direcionadas.
+    bool directed;
+    // Indica se alguma aresta foi registrada com peso.
+    bool weighted = false;
+
+public:
+    /**
+     * @brief Cria um construtor vazio.
+     * @param is_directed Indica se as arestas registradas são direcionadas.
+     */
+    explicit GraphBuilder(bool is_directed = true) : directed(is_directed) {}
+
+    /**
+     * @brief Reserva espaço para um número esperado de arestas.
+     */
+    void reserve_edges(size_t edge_count) {
+        sources.reserve(edge_count);
+        targets.reserve(edge_count);
+    }
+
+    /**
+     * @brief Registra um nó, caso ainda não exista.
+     * @return O índice do nó no construtor.
+     */
+    int add_node(const Node& node) {
+        auto it = node_to_index.find(node);
+        if (it != node_to_index.end()) {
+            return static_cast<int>(it->second);
+        }
+        int index = static_cast<int>(nodes.size());
+        node_to_index.emplace(node, static_cast<size_t>(index));
+        nodes.push_back(node);
+        return index;
+    }
+
+    /**
+     * @brief Registra uma aresta entre dois índices já atribuídos por add_node.
+     *
+     * É o caminho usado por leitores de arquivos que já trabalham com índices.
+     * @throws std::out_of_range se algum índice for inválido.
+     */
+    void add_edge_indices(int from, int to) {
+        if (from < 0 || to < 0 || static_cast<size_t>(from) >= nodes.size() || static_cast<size_t>(to) >= nodes.size()) {
+            throw std::out_of_range("GraphBuilder::add_edge_indices: Index out of range");
+        }
+        sources.push_back(from);
+        targets.push_back(to);
+        if (weighted) {
+            weights.push_back(std::numeric_limits<double>::quiet_NaN());
+        }
+    }
+
+    void add_edge_indices(int from, int to, double weight) {
+        if (!weighted) {
+            // As arestas registradas até aqui ficam marcadas como sem peso.
+            weights.assign(sources.size(), std::numeric_limits<double>::quiet_NaN());
+            weighted = true;
+        }
+        add_edge_indices(from, to);
+        weights.back() = weight;
+    }
+
+    /**
+     * @brief Registra de uma vez as arestas de vários lotes, na ordem do vetor, liberando cada lote.
+     *
+     * A posição de cada lote nos vetores do construtor é a soma de prefixos dos tamanhos dos
+     * lotes anteriores, então os vetores crescem uma única vez e cada lote é verificado e
+     * copiado para a sua faixa por uma thread própria, sem passar por add_node. O resultado é
+     * o mesmo de chamar add_edge_indices para cada aresta, na ordem dos lotes.
+     * @throws std::out_of_range se algum índice for inválido; nesse caso, nenhuma aresta dos
+     * lotes é registrada.
+     */
+    void append_edge_blocks(std::vector<EdgeIndexBlock>& blocks) {
+        size_t first = sources.size();
+        bool was_weighted = weighted;
+        std::vector<size_t> offsets(blocks.size() + 1, first);
+        bool any_weights = false;
+        for (size_t b = 0; b < blocks.size(); ++b) {
+            offsets[b + 1] = offsets[b] + blocks[b].sources.size();
+            any_weights = any_weights || !blocks[b].weights.empty();
+        }
+        if (any_weights && !weighted) {
+            // As arestas registradas até aqui ficam marcadas como sem peso.
+            weights.assign(first, std::numeric_limits<double>::quiet_NaN());
+            weighted = true;
+        }
+        sources.resize(offsets.back());
+        targets.resize(offsets.back());
+        if (weighted) {
+            weights.resize(offsets.back());
+        }
+
+        int order = static_cast<int>(nodes.size());
+        auto copy_block = [&](size_t b) {
+            EdgeIndexBlock& block = blocks[b];
+            for (size_t k = 0; k < block.sources.size(); ++k) {
+                if (block.sources[k] < 0 || block.targets[k] < 0 || block.sources[k] >= order || block.targets[k] >= order) {
+                    throw std::out_of_range("GraphBuilder::append_edge_blocks: Index out of range");
+                }
+            }
+            std::copy(block.sources.begin(), block.sources.end(), sources.begin() + offsets[b]);
+            std::copy(block.targets.begin(), block.targets.end(), targets.begin() + offsets[b]);
+            if (weighted && block.weights.empty()) {
+                std::fill(weights.begin() + offsets[b], weights.begin() + offsets[b + 1],
+                          std::numeric_limits<double>::quiet_NaN());
+            } else if (weighted) {
+                std::copy(block.weights.begin(), block.weights.end(), weights.begin() + offsets[b]);
+            }
+            block = EdgeIndexBlock();
+        };
+
+        std::vector<std::exception_ptr> errors(blocks.size());
+        if (blocks.size() == 1) {
+            try {
+                copy_block(0);
+            } catch (...) {
+                errors[0] = std::current_exception();
+            }
+        } else {
+            std::vector<std::thread> workers;
+            workers.reserve(blocks.size());
+            for (size_t b = 0; b < blocks.size(); ++b) {
+                workers.emplace_back([&, b]() {
+                    try {
+                        copy_block(b);
+                    } catch (...) {
+                        errors[b] = std::current_exception();
+                    }
+                });
+            }
+            for (std::thread& worker : workers) {
+                worker.join();
+            }
+        }
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                sources.resize(first);
+                targets.resize(first);
+                weights.resize(was_weighted ? first : 0);
+                weighted = was_weighted;
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    /**
+     * @brief Registra uma aresta, adicionando os nós que ainda não existirem.
+     *
+     * Assim como add_edge sem peso em IWeightedGraph, a aresta recebe peso 1 apenas se
+     * nenhuma ocorrência dela for registrada com peso.
+     */
+    void add_edge(const Node& from, const Node& to) {
+        int from_index = add_node(from);
+        add_edge_indices(from_index, add_node(to));
+    }
+
+    /**
+     * @brief Registra uma aresta com peso. Se a aresta se repetir, prevalece o último peso.
+     */
+    void add_edge(const Node& from, const Node& to, double weight) {
+        int from_index = add_node(from);
+        add_edge_indices(from_index, add_node(to), weight);
+    }
+
+    size_t get_order() const {
+        return nodes.size();
+    }
+
+    /**
+     * @brief Retorna o número de arestas registradas, incluindo as repetidas.
+     */
+    size_t get_edge_count() const {
+        return sources.size();
+    }
+
+    bool is_directed() const {
+        return directed;
+    }
+
+    bool is_weighted() const {
+        return weighted;
+    }
+
+    const std::vector<Node>& get_nodes() const {
+        return nodes;
+    }
+
+    /**
+     * @brief Agrupa as arestas registradas por origem e remove as repetidas.
+     */
+    AdjacencyArrays adjacency() const {
+        return group_arcs(nodes.size(), sources, targets, weights, directed);
+    }
+
+    /**
+     * @brief Insere os nós e as arestas registradas em um grafo.
+     *
+     * Os nós são adicionados na ordem dos índices do construtor. Se o grafo já possuía nós com
+     * outros índices, os arcos são renumerados para os índices do grafo antes da inserção.
+     * @param graph O grafo de destino, que deve ter a mesma direcionalidade do construtor.
+     * @throws std::invalid_argument se a direcionalidade do grafo for diferente.
+     */
+    void build(IGraph<Node>& graph) const {
+        AdjacencyArrays arrays = prepare(graph);
+        graph.add_adjacency(arrays.offsets, arrays.targets);
+    }
+
+    /**
+     * @brief Insere os nós e as arestas registradas, com os seus pesos, em um grafo ponderado.
+     *
+     * Arestas registradas sem peso recebem peso 1.
+     */
+    void build(IWeightedGraph<Node>& graph) const {
+        AdjacencyArrays arrays = prepare(graph);
+        if (arrays.weights.empty()) {
+            arrays.weights.assign(arrays.targets.size(), 1.0);
+        }
+        graph.add_weighted_adjacency(arrays.offsets, arrays.targets, arrays.weights);
+    }
+
+private:
+    /**
+     * @brief Adiciona os nós ao grafo e devolve os arcos já nos índices do grafo.
+     */
+    AdjacencyArrays prepare(IGraph<Node>& graph) const {
+        if (graph.is_directed() != directed) {
+            throw std::invalid_argument("GraphBuilder::build: graph directedness does not match the builder");
+        }
+
+        std::vector<int> graph_index(nodes.size());
+        bool identity = true;
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            graph.add_node(nodes[i]);
+            graph_index[i] = graph.get_index(nodes[i]);
+            identity = identity && graph_index[i] == static_cast<int>(i);
+        }
+
+        AdjacencyArrays arrays = adjacency();
+        size_t order = graph.get_order();
+        if (identity) {
+            // Nós extras já existentes no grafo ficam sem arcos novos.
+            arrays.offsets.resize(order + 1, arrays.targets.size());
+            return arrays;
+        }
+
+        // Reorganiza as linhas para os índices do grafo, renumerando também os destinos.
+        AdjacencyArrays remapped;
+        remapped.offsets.assign(order + 1, 0);
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            remapped.offsets[graph_index[i] + 1] = arrays.offsets[i + 1] - arrays.offsets[i];
+        }
+        for (size_t i = 0; i < order; ++i) {
+            remapped.offsets[i + 1] += remapped.offsets[i];
+        }
+        remapped.targets.resize(arrays.targets.size());
+        remapped.weights.resize(arrays.weights.size());
+        for (size_t i = 0; i < nodes.size(); ++i) {
+            size_t write = remapped.offsets[graph_index[i]];
+            for (size_t k = arrays.offsets[i]; k < arrays.offsets[i + 1]; ++k, ++write) {
+                remapped.targets[write] = graph_index[arrays.targets[k]];
+                if (!arrays.weights.empty()) {
+                    remapped.weights[write] = arrays.weights[k];
+                }
+            }
+        }
+        return remapped;
+    }
+};
+
+#endif // GRAPHBUILDER_H
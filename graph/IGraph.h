@@ -3,6 +3,9 @@
 
 #include <vector>
 #include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <stdexcept>
 
 /**
  * @struct EdgeIndex
@@ -13,6 +16,53 @@ struct EdgeIndex {
     int to;
 };
 
+/**
+ * @class VisitorRef
+ * @brief Referência leve para a função chamada a cada elemento durante uma iteração.
+ * @tparam Args Os tipos dos argumentos recebidos pela função de visita.
+ *
+ * Guarda apenas o endereço do objeto chamável, sem copiá-lo e sem alocar memória, por isso
+ * o objeto deve continuar existindo durante toda a iteração (o caso natural de uma lambda
+ * passada diretamente para for_each_neighbor). Se o chamável retornar bool, retornar false
+ * interrompe a iteração; chamáveis sem retorno percorrem todos os elementos.
+ */
+template<typename... Args>
+class VisitorRef {
+    void* callable;
+    bool (*invoke)(void*, Args...);
+
+    template<typename F>
+    static bool call(void* callable, Args... args) {
+        F& function = *static_cast<F*>(callable);
+        if constexpr (std::is_same_v<decltype(function(args...)), bool>) {
+            return function(args...);
+        } else {
+            function(args...);
+            return true;
+        }
+    }
+
+public:
+    template<typename F, typename = std::enable_if_t<!std::is_same_v<std::decay_t<F>, VisitorRef>>>
+    VisitorRef(F&& function)
+        : callable(const_cast<void*>(static_cast<const void*>(std::addressof(function))))
+        , invoke(&call<std::remove_reference_t<F>>) {}
+
+    /**
+     * @brief Visita um elemento.
+     * @param args Os dados do elemento visitado.
+     * @return false se a iteração deve ser interrompida, true caso contrário.
+     */
+    bool operator()(Args... args) const {
+        return invoke(callable, args...);
+    }
+};
+
+/**
+ * @brief Função de visita que recebe o índice de cada vizinho.
+ */
+using NeighborVisitor = VisitorRef<int>;
+
 /**
  * @class IGraph
  * @brief Interface genérica para Grafos.
@@ -57,6 +107,22 @@ public:
      */
     virtual void remove_node(const Node& node) = 0;
 
+    /**
+     * @brief Remove vários nós do grafo de uma só vez.
+     *
+     * Nós que não existem no grafo são ignorados. A implementação padrão chama remove_node
+     * para cada nó; representações em que cada remoção percorre o grafo inteiro a sobrescrevem
+     * para compactar a estrutura uma única vez. Os índices dos nós restantes podem mudar.
+     * @param nodes Os nós a serem removidos.
+     */
+    virtual void remove_nodes(const std::vector<Node>& nodes) {
+        for (const Node& node : nodes) {
+            if (has_node(node)) {
+                remove_node(node);
+            }
+        }
+    }
+
     /**
      * @brief Adiciona uma aresta entre dois nós.
      *
@@ -75,6 +141,31 @@ public:
      */
     virtual void remove_edge(const Node& from, const Node& to) = 0;
 
+    /**
+     * @brief Adiciona de uma só vez os arcos de nós já existentes, agrupados por origem.
+     *
+     * Os destinos dos arcos que saem do nó de índice i estão em
+     * targets[offsets[i]] .. targets[offsets[i + 1] - 1], sem repetições dentro de cada origem
+     * (o formato produzido por group_arcs). Em grafos não-direcionados, cada aresta aparece nos
+     * dois sentidos. A implementação padrão chama add_edge para cada aresta; representações
+     * cujo add_edge procura duplicatas na estrutura a sobrescrevem para preencher a estrutura
+     * diretamente quando o grafo ainda não possui arestas.
+     * @param offsets O início dos arcos de cada nó, com get_order() + 1 posições.
+     * @param targets Os índices de destino dos arcos.
+     */
+    virtual void add_adjacency(const std::vector<size_t>& offsets, const std::vector<int>& targets) {
+        bool directed = is_directed();
+        for (int from_index = 0; from_index + 1 < static_cast<int>(offsets.size()); ++from_index) {
+            Node from = get_node(from_index);
+            for (size_t k = offsets[from_index]; k < offsets[from_index + 1]; ++k) {
+                // Em grafos não-direcionados, a aresta é adicionada apenas a partir do menor índice.
+                if (directed || from_index <= targets[k]) {
+                    add_edge(from, get_node(targets[k]));
+                }
+            }
+        }
+    }
+
     /**
      * @brief Retorna uma lista com todos os vizinhos de um determinado nó.
      *
@@ -129,6 +220,73 @@ public:
      */
     virtual std::vector<int> get_neighbors_indices(int index) const = 0;
 
+    /**
+     * @brief Percorre os índices dos vizinhos de um nó sem criar uma cópia da lista.
+     *
+     * É a forma preferida de acessar vizinhos durante travessias, pois não aloca memória.
+     * A implementação padrão recorre a get_neighbors_indices; as representações do
+     * repositório a sobrescrevem percorrendo diretamente a sua estrutura interna.
+     * @param index O índice do nó cujos vizinhos serão visitados.
+     * @param visit A função chamada com o índice de cada vizinho, na mesma ordem de get_neighbors_indices.
+     * @return false se a iteração foi interrompida pela função de visita, true caso contrário.
+     */
+    virtual bool for_each_neighbor(int index, NeighborVisitor visit) const {
+        for (int neighbor_index : get_neighbors_indices(index)) {
+            if (!visit(neighbor_index)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Percorre os índices dos nós que possuem uma aresta chegando no nó dado.
+     *
+     * Permite algoritmos que puxam informação dos predecessores (travessia do grafo
+     * transposto, busca para trás) sem construir o grafo transposto. A implementação padrão
+     * procura o nó na vizinhança de todos os vértices, custando O(V + E) por chamada;
+     * representações que guardam as arestas de entrada a sobrescrevem. Em grafos
+     * não-direcionados, equivale a for_each_neighbor.
+     * @param index O índice do nó cujos vizinhos de entrada serão visitados.
+     * @param visit A função chamada com o índice de cada nó de origem.
+     * @return false se a iteração foi interrompida pela função de visita, true caso contrário.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    virtual bool for_each_in_neighbor(int index, NeighborVisitor visit) const {
+        if (!is_directed()) {
+            return for_each_neighbor(index, visit);
+        }
+        if (index < 0 || static_cast<size_t>(index) >= get_order()) {
+            throw std::out_of_range("for_each_in_neighbor: Index out of range");
+        }
+
+        bool stopped = false;
+        for (int from_index = 0; from_index < static_cast<int>(get_order()) && !stopped; ++from_index) {
+            for_each_neighbor(from_index, [&](int to_index) {
+                if (to_index != index) {
+                    return true;
+                }
+                stopped = !visit(from_index);
+                // Cada aresta aparece uma única vez, então a busca nesta lista pode parar.
+                return false;
+            });
+        }
+        return !stopped;
+    }
+
+    /**
+     * @brief Indica se for_each_in_neighbor custa o mesmo que for_each_neighbor.
+     *
+     * Algoritmos que percorrem os predecessores de muitos nós (como a etapa bottom-up da BFS
+     * com otimização de direção) usam for_each_in_neighbor diretamente quando este método
+     * retorna true, e constroem os arcos de entrada uma única vez quando retorna false, em vez
+     * de pagar O(V + E) a cada chamada da implementação padrão. É verdadeiro em grafos
+     * não-direcionados e nas representações que guardam ou leem diretamente as arestas de entrada.
+     */
+    virtual bool has_in_neighbor_access() const {
+        return !is_directed();
+    }
+
      /**
      * @brief Calcula o grau de entrada de um nó.
      *
@@ -166,6 +324,15 @@ public:
      */
     virtual std::vector<EdgeIndex> get_all_edges() const = 0;
 
+    /**
+     * @brief Indica se o grafo é direcionado.
+     *
+     * Permite que construções genéricas (cópias, conversões de representação) preservem
+     * a semântica das arestas do grafo de origem.
+     * @return true se o grafo for direcionado, false caso contrário.
+     */
+    virtual bool is_directed() const = 0;
+
 };
 
 #endif // IGRAPH_H
@@ -0,0 +1,107 @@
+#ifndef IWEIGHTEDGRAPH_H
+#define IWEIGHTEDGRAPH_H
+
+#include <limits>
+
+#include "IGraph.h"
+
+/**
+ * @struct WeightedEdge
+ * @brief Estrutura auxiliar para armazenar arestas com peso e facilitar a ordenação.
+ */
+struct WeightedEdge {
+    int from;
+    int to;
+    double weight;
+
+    /**
+     * @brief Sempre que você precisar comparar duas WeightedEdge com o operador <, o critério é o campo weight.
+     */
+    bool operator<(const WeightedEdge& other) const {
+        return weight < other.weight;
+    }
+};
+
+/**
+ * @struct WeightedNeighbor
+ * @brief Vizinho de um nó armazenado junto com o peso da aresta que leva até ele.
+ */
+struct WeightedNeighbor {
+    int index;
+    double weight;
+};
+
+/**
+ * @brief Função de visita que recebe o índice de cada vizinho e o peso da aresta até ele.
+ */
+using WeightedNeighborVisitor = VisitorRef<int, double>;
+
+/**
+ * @class IWeightedGraph
+ * @brief Interface para grafos que armazenam o peso de cada aresta junto à própria aresta.
+ * @tparam Node O tipo de dado que será armazenado em cada nó (vértice) do grafo.
+ *
+ * Diferente da matriz de pesos separada (de tamanho ordem x ordem) usada pelas versões
+ * originais dos algoritmos, os pesos ficam ao lado de cada vizinho, de modo que a memória
+ * ocupada é proporcional ao número de vértices mais o número de arestas.
+ *
+ * Arestas adicionadas pela operação sem peso de IGraph recebem peso 1.
+ */
+template<typename Node>
+class IWeightedGraph : public IGraph<Node> {
+public:
+    using IGraph<Node>::add_edge;
+
+    /**
+     * @brief Adiciona uma aresta com peso entre dois nós.
+     *
+     * Se a aresta já existir, o seu peso é substituído pelo novo valor.
+     * @param from O nó de origem da aresta.
+     * @param to O nó de destino da aresta.
+     * @param weight O peso da aresta.
+     */
+    virtual void add_edge(const Node& from, const Node& to, double weight) = 0;
+
+    /**
+     * @brief Adiciona de uma só vez os arcos com peso de nós já existentes, agrupados por origem.
+     *
+     * Mesmo formato de IGraph::add_adjacency, com 'weights' paralelo a 'targets'. A
+     * implementação padrão chama add_edge com peso para cada aresta.
+     * @param offsets O início dos arcos de cada nó, com get_order() + 1 posições.
+     * @param targets Os índices de destino dos arcos.
+     * @param weights O peso de cada arco.
+     */
+    virtual void add_weighted_adjacency(const std::vector<size_t>& offsets, const std::vector<int>& targets,
+                                        const std::vector<double>& weights) {
+        bool directed = this->is_directed();
+        for (int from_index = 0; from_index + 1 < static_cast<int>(offsets.size()); ++from_index) {
+            Node from = this->get_node(from_index);
+            for (size_t k = offsets[from_index]; k < offsets[from_index + 1]; ++k) {
+                if (directed || from_index <= targets[k]) {
+                    add_edge(from, this->get_node(targets[k]), weights[k]);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Retorna o peso da aresta entre dois nós, dados os seus índices.
+     *
+     * @param from_index O índice do nó de origem.
+     * @param to_index O índice do nó de destino.
+     * @return O peso da aresta, ou infinito caso a aresta não exista.
+     */
+    virtual double get_weight(int from_index, int to_index) const = 0;
+
+    /**
+     * @brief Percorre os vizinhos de um nó junto com o peso de cada aresta, sem alocar memória.
+     *
+     * Os vizinhos são visitados na mesma ordem de for_each_neighbor.
+     * @param index O índice do nó cujos vizinhos serão visitados.
+     * @param visit A função chamada com o índice de cada vizinho e o peso da aresta até ele.
+     * @return false se a iteração foi interrompida pela função de visita, true caso contrário.
+     */
+    virtual bool for_each_weighted_neighbor(int index, WeightedNeighborVisitor visit) const = 0;
+};
+
+#endif // IWEIGHTEDGRAPH_H
@@ -0,0 +1,245 @@
+#ifndef NODEMAP_H
+#define NODEMAP_H
+
+#include <vector>
+#include <unordered_map>
+#include <utility>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+#include <cstddef>
+
+/**
+ * @brief Mapeamento de nós para índices baseado em tabela hash.
+ *
+ * Funciona para qualquer tipo de nó que possua std::hash, e é o mapeamento usado pelas
+ * representações quando nenhum outro é indicado.
+ */
+template<typename Node>
+using HashNodeMap = std::unordered_map<Node, size_t>;
+
+/**
+ * @struct DenseNodeKey
+ * @brief Define a posição de um nó no vetor de DenseNodeMap.
+ *
+ * Para tipos inteiros, a posição é o próprio valor do nó. Nos tipos com sinal de até 16 bits
+ * (char, short), a posição é a representação sem sinal do valor, de modo que nós negativos,
+ * como (char)0xE9, também são aceitos e o vetor nunca passa de 65536 posições. Tipos que já
+ * carregam um identificador inteiro denso (como InternedString, em StringPool.h) especializam
+ * este trait para também usarem DenseNodeMap.
+ */
+template<typename Node>
+struct DenseNodeKey {
+    // Indica se o tipo pode ser usado em DenseNodeMap.
+    static constexpr bool supported = std::is_integral_v<Node>;
+    // Indica se DefaultNodeMap deve escolher DenseNodeMap para o tipo.
+    static constexpr bool prefer_dense = std::is_integral_v<Node> && sizeof(Node) <= 2;
+    // Mensagem da exceção lançada ao registrar um nó sem posição válida.
+    static constexpr const char* invalid_message = "DenseNodeMap: node must be non-negative";
+
+    /**
+     * @brief Retorna a posição do nó, ou o maior size_t para nós negativos de tipos com sinal
+     * maiores que 16 bits.
+     */
+    static size_t of(const Node& node) {
+        if constexpr (std::is_signed_v<Node> && sizeof(Node) <= 2) {
+            return static_cast<size_t>(static_cast<std::make_unsigned_t<Node>>(node));
+        } else if constexpr (std::is_signed_v<Node>) {
+            if (node < 0) {
+                return std::numeric_limits<size_t>::max();
+            }
+        }
+        return static_cast<size_t>(node);
+    }
+};
+
+/**
+ * @class DenseNodeMap
+ * @brief Mapeamento de nós inteiros para índices usando um vetor indexado pelo próprio nó.
+ * @tparam Node Um tipo inteiro (int, char, ...) ou com DenseNodeKey especializado.
+ *
+ * Quando os nós são inteiros pequenos e densos (como os gerados por create_nodes: 1..n ou
+ * 'A'..), a posição do nó em um vetor substitui a tabela hash: encontrar o índice de um nó é
+ * um acesso direto, sem calcular hash nem percorrer buckets, e cada nó ocupa apenas uma
+ * posição do vetor. O vetor tem tamanho igual ao maior nó registrado mais um, então este
+ * mapeamento não é adequado para identificadores esparsos ou muito grandes.
+ *
+ * Oferece o subconjunto da interface de std::unordered_map usado pelas representações, de
+ * modo que pode ser trocado pelo HashNodeMap sem alterar o código delas.
+ */
+template<typename Node>
+class DenseNodeMap {
+    static_assert(DenseNodeKey<Node>::supported, "DenseNodeMap: Node must be an integral type or specialize DenseNodeKey");
+
+    // Marca uma posição do vetor sem nó associado.
+    static constexpr size_t EMPTY = std::numeric_limits<size_t>::max();
+
+    // slots[n] guarda o índice do nó n, ou EMPTY caso ele não esteja registrado.
+    std::vector<size_t> slots;
+    // Número de nós registrados.
+    size_t count_nodes = 0;
+
+    /**
+     * @brief Retorna a posição do nó no vetor, ou EMPTY para nós sem posição válida.
+     */
+    static size_t key_of(const Node& node) {
+        return DenseNodeKey<Node>::of(node);
+    }
+
+    /**
+     * @brief Retorna a posição do nó no vetor, aumentando-o se necessário.
+     * @throws std::out_of_range se o nó não tiver posição válida: um nó negativo de um tipo com
+     * sinal maior que 16 bits, como DenseNodeMap<int> escolhido explicitamente, ou um
+     * InternedString inválido. A mensagem é a de DenseNodeKey<Node>::invalid_message.
+     */
+    size_t ensure_slot(const Node& node) {
+        size_t key = key_of(node);
+        if (key == EMPTY) {
+            throw std::out_of_range(DenseNodeKey<Node>::invalid_message);
+        }
+        if (key >= slots.size()) {
+            slots.resize(key + 1, EMPTY);
+        }
+        return key;
+    }
+
+public:
+    /**
+     * @brief Par (nó, índice) devolvido pelos iteradores, como em std::unordered_map.
+     */
+    struct value_type {
+        Node first;
+        size_t second;
+    };
+
+    /**
+     * @class iterator
+     * @brief Resultado de find: aponta para um par (nó, índice) ou é igual a end().
+     */
+    class iterator {
+        value_type entry;
+        bool valid;
+
+    public:
+        iterator() : entry{Node(), 0}, valid(false) {}
+        iterator(const Node& node, size_t index) : entry{node, index}, valid(true) {}
+
+        const value_type& operator*() const { return entry; }
+        const value_type* operator->() const { return &entry; }
+
+        bool operator==(const iterator& other) const {
+            return valid == other.valid && (!valid || entry.first == other.entry.first);
+        }
+        bool operator!=(const iterator& other) const { return !(*this == other); }
+    };
+    using const_iterator = iterator;
+
+    iterator find(const Node& node) const {
+        size_t key = key_of(node);
+        if (key < slots.size() && slots[key] != EMPTY) {
+            return iterator(node, slots[key]);
+        }
+        return end();
+    }
+
+    iterator end() const {
+        return iterator();
+    }
+
+    size_t count(const Node& node) const {
+        return find(node) != end() ? 1 : 0;
+    }
+
+    /**
+     * @brief Retorna o índice de um nó registrado.
+     * @throws std::out_of_range se o nó não estiver registrado.
+     */
+    size_t at(const Node& node) const {
+        auto it = find(node);
+        if (it == end()) {
+            throw std::out_of_range("DenseNodeMap::at: node not found");
+        }
+        return it->second;
+    }
+
+    /**
+     * @brief Retorna uma referência ao índice de um nó, registrando-o com índice 0 caso não exista.
+     */
+    size_t& operator[](const Node& node) {
+        size_t key = ensure_slot(node);
+        if (slots[key] == EMPTY) {
+            slots[key] = 0;
+            count_nodes++;
+        }
+        return slots[key];
+    }
+
+    /**
+     * @brief Registra um nó com o índice dado, caso ele ainda não exista.
+     * @return O iterador para o nó e true se ele foi registrado agora.
+     */
+    std::pair<iterator, bool> emplace(const Node& node, size_t index) {
+        size_t key = ensure_slot(node);
+        if (slots[key] != EMPTY) {
+            return {iterator(node, slots[key]), false};
+        }
+        slots[key] = index;
+        count_nodes++;
+        return {iterator(node, index), true};
+    }
+
+    /**
+     * @brief Remove o registro de um nó.
+     * @return O número de nós removidos (0 ou 1).
+     */
+    size_t erase(const Node& node) {
+        size_t key = key_of(node);
+        if (key >= slots.size() || slots[key] == EMPTY) {
+            return 0;
+        }
+        slots[key] = EMPTY;
+        count_nodes--;
+        return 1;
+    }
+
+    size_t size() const {
+        return count_nodes;
+    }
+
+    bool empty() const {
+        return count_nodes == 0;
+    }
+
+    /*Sem relação direta com o número de nós, já que o vetor é indexado pelo valor do nó*/
+    void reserve(size_t) {}
+
+    void clear() {
+        slots.clear();
+        count_nodes = 0;
+    }
+};
+
+/**
+ * @brief Mapeamento usado por padrão pelas representações de grafo.
+ *
+ * Tipos inteiros de até 16 bits (char, short, ...) usam DenseNodeMap, pois o vetor nunca passa
+ * de 65536 posições, inclusive para valores negativos, assim como os tipos cujo DenseNodeKey
+ * indica prefer_dense; os demais tipos usam HashNodeMap. Para nós int densos (1..n),
+ * DenseNodeMap pode ser escolhido explicitamente, por exemplo
+ * DirectedAdjacencyListGraph<int, DenseNodeMap<int>>.
+ */
+template<typename Node>
+using DefaultNodeMap = std::conditional_t<DenseNodeKey<Node>::prefer_dense, DenseNodeMap<Node>, HashNodeMap<Node>>;
+
+/**
+ * @brief Mapeamento para nós cujos identificadores são sabidamente densos.
+ *
+ * É o mapeamento dos GraphBuilder devolvidos pelos leitores cujo cabeçalho declara os nós 1..n
+ * (create_nodes, DIMACS, Matrix Market), que rejeitam nós fora do cabeçalho: os tipos aceitos
+ * por DenseNodeMap, inclusive int, usam o vetor, e os demais (como std::string) usam
+ * DefaultNodeMap.
+ */
+template<typename Node>
+using DenseIdNodeMap = std::conditional_t<DenseNodeKey<Node>::supported, DenseNodeMap<Node>, DefaultNodeMap<Node>>;
+
+#endif // NODEMAP_H
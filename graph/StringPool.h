@@ -0,0 +1,224 @@
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <memory>
+#include <unordered_map>
+#include <functional>
+#include <ostream>
+#include <limits>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+
+#include "NodeMap.h"
+
+class StringPool;
+
+/**
+ * @class InternedString
+ * @brief Rótulo de nó guardado uma única vez em um StringPool e identificado por um inteiro.
+ *
+ * Copiar, comparar e calcular o hash de um InternedString usa apenas o identificador, sem
+ * tocar no texto; o texto só é lido para imprimir o rótulo. Os identificadores são densos
+ * (0, 1, 2, ... na ordem em que os rótulos são internados), então as representações de grafo
+ * usam DenseNodeMap para InternedString e get_index/get_node se reduzem a acessos a vetores.
+ *
+ * A ordem (operator<) é a ordem de internação, não a ordem alfabética. Rótulos de pools
+ * diferentes não devem ser misturados em um mesmo grafo.
+ */
+class InternedString {
+    static constexpr uint32_t INVALID_ID = std::numeric_limits<uint32_t>::max();
+
+    const StringPool* pool = nullptr;
+    uint32_t label_id = INVALID_ID;
+
+    friend class StringPool;
+    InternedString(const StringPool* pool, uint32_t label_id) : pool(pool), label_id(label_id) {}
+
+public:
+    /*Rótulo vazio, que não pertence a nenhum pool*/
+    InternedString() = default;
+
+    /**
+     * @brief Retorna o identificador denso do rótulo no seu pool.
+     */
+    uint32_t id() const {
+        return label_id;
+    }
+
+    /**
+     * @brief Indica se o rótulo pertence a um pool.
+     */
+    bool valid() const {
+        return pool != nullptr;
+    }
+
+    /**
+     * @brief Retorna o texto do rótulo, guardado no pool; vazio para um rótulo inválido.
+     */
+    std::string_view view() const;
+
+    /**
+     * @brief Retorna uma cópia do texto do rótulo.
+     */
+    std::string str() const {
+        return std::string(view());
+    }
+
+    bool operator==(const InternedString& other) const { return label_id == other.label_id; }
+    bool operator!=(const InternedString& other) const { return label_id != other.label_id; }
+    bool operator<(const InternedString& other) const { return label_id < other.label_id; }
+};
+
+/**
+ * @class StringPool
+ * @brief Guarda cada rótulo distinto uma única vez e lhe atribui um identificador denso.
+ *
+ * Os textos são copiados para blocos grandes alocados em sequência (uma arena), em vez de um
+ * std::string por rótulo, e nunca mudam de endereço; por isso os InternedString e os
+ * std::string_view devolvidos permanecem válidos enquanto o pool existir. Um rótulo é
+ * convertido em identificador apenas uma vez, ao ser internado; daí em diante os algoritmos
+ * trabalham somente com inteiros.
+ *
+ * O pool não pode ser copiado nem movido, pois os InternedString apontam para ele, e deve
+ * viver mais que os grafos que usam seus rótulos. Não é seguro para uso concorrente.
+ */
+class StringPool {
+    static constexpr size_t BLOCK_SIZE = 64 * 1024;
+
+    // Blocos da arena; o último bloco de tamanho BLOCK_SIZE é o que recebe novos textos.
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char* cursor = nullptr;
+    size_t remaining = 0;
+
+    // labels[id] é o texto do rótulo id.
+    std::vector<std::string_view> labels;
+    std::unordered_map<std::string_view, uint32_t> ids;
+
+    /**
+     * @brief Copia o texto para a arena e retorna a cópia.
+     */
+    std::string_view store(std::string_view text) {
+        if (text.empty()) {
+            return std::string_view();
+        }
+        if (text.size() > BLOCK_SIZE / 4) {
+            // Textos grandes ganham um bloco próprio, sem descartar o restante do bloco atual.
+            blocks.push_back(std::make_unique<char[]>(text.size()));
+            std::memcpy(blocks.back().get(), text.data(), text.size());
+            return std::string_view(blocks.back().get(), text.size());
+        }
+        if (text.size() > remaining) {
+            blocks.push_back(std::make_unique<char[]>(BLOCK_SIZE));
+            cursor = blocks.back().get();
+            remaining = BLOCK_SIZE;
+        }
+        std::memcpy(cursor, text.data(), text.size());
+        std::string_view stored(cursor, text.size());
+        cursor += text.size();
+        remaining -= text.size();
+        return stored;
+    }
+
+public:
+    StringPool() = default;
+    StringPool(const StringPool&) = delete;
+    StringPool& operator=(const StringPool&) = delete;
+
+    /**
+     * @brief Reserva espaço para a quantidade de rótulos informada.
+     */
+    void reserve(size_t count) {
+        labels.reserve(count);
+        ids.reserve(count);
+    }
+
+    /**
+     * @brief Retorna o rótulo do texto, internando-o se ele ainda não estiver no pool.
+     * @throws std::length_error se o pool já tiver o número máximo de rótulos.
+     */
+    InternedString intern(std::string_view text) {
+        auto it = ids.find(text);
+        if (it != ids.end()) {
+            return InternedString(this, it->second);
+        }
+        if (labels.size() >= InternedString::INVALID_ID) {
+            throw std::length_error("StringPool: too many labels");
+        }
+        std::string_view stored = store(text);
+        uint32_t id = static_cast<uint32_t>(labels.size());
+        labels.push_back(stored);
+        ids.emplace(stored, id);
+        return InternedString(this, id);
+    }
+
+    /**
+     * @brief Retorna o rótulo de um texto já internado, ou um rótulo inválido se ele não existir.
+     */
+    InternedString find(std::string_view text) const {
+        auto it = ids.find(text);
+        return it == ids.end() ? InternedString() : InternedString(this, it->second);
+    }
+
+    /**
+     * @brief Retorna o rótulo com o identificador dado.
+     * @throws std::out_of_range se o identificador não existir.
+     */
+    InternedString at(uint32_t id) const {
+        if (id >= labels.size()) {
+            throw std::out_of_range("StringPool::at: Index out of range");
+        }
+        return InternedString(this, id);
+    }
+
+    /**
+     * @brief Retorna o texto do rótulo com o identificador dado.
+     */
+    std::string_view view(uint32_t id) const {
+        return labels[id];
+    }
+
+    /**
+     * @brief Retorna o número de rótulos distintos no pool.
+     */
+    size_t size() const {
+        return labels.size();
+    }
+};
+
+inline std::string_view InternedString::view() const {
+    return pool ? pool->view(label_id) : std::string_view();
+}
+
+inline std::ostream& operator<<(std::ostream& out, const InternedString& label) {
+    return out << label.view();
+}
+
+namespace std {
+template<>
+struct hash<InternedString> {
+    size_t operator()(const InternedString& label) const noexcept {
+        return std::hash<uint32_t>()(label.id());
+    }
+};
+}
+
+/*InternedString usa o próprio identificador como posição em DenseNodeMap. Um rótulo inválido
+  (criado por InternedString() ou devolvido por StringPool::find) não tem posição: buscá-lo não
+  encontra nada, e registrá-lo como nó é rejeitado*/
+template<>
+struct DenseNodeKey<InternedString> {
+    static constexpr bool supported = true;
+    static constexpr bool prefer_dense = true;
+    static constexpr const char* invalid_message =
+        "DenseNodeMap: InternedString label is invalid (it does not belong to a StringPool)";
+
+    static size_t of(const InternedString& label) {
+        return label.valid() ? static_cast<size_t>(label.id()) : std::numeric_limits<size_t>::max();
+    }
+};
+
+#endif // STRING_POOL_H
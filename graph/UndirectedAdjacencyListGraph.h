@@ -8,13 +8,14 @@
  * @class UndirectedAdjacencyListGraph
  * @brief Classe que implementa uma representação de grafo não-direcionado usando listas de adjacência.
  * @tparam Node O tipo de dado que será armazenado em cada vértice do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
  *
  * Esta classe herda de um grafo direcionado (`DirectedAdjacencyListGraph`) e
  * sobrescreve os métodos de manipulação de arestas para garantir a natureza
  * bidirecional.
  */
-template<typename Node>
-class UndirectedAdjacencyListGraph : public DirectedAdjacencyListGraph<Node> {
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class UndirectedAdjacencyListGraph : public DirectedAdjacencyListGraph<Node, NodeMap> {
     
     public:
         /**
@@ -28,8 +29,8 @@ class UndirectedAdjacencyListGraph : public DirectedAdjacencyListGraph<Node> {
          * @param v O segundo nó da aresta.
          */
         void add_edge(const Node& u, const Node& v) override {
-            DirectedAdjacencyListGraph<Node>::add_edge(u, v);
-            DirectedAdjacencyListGraph<Node>::add_edge(v, u);
+            DirectedAdjacencyListGraph<Node, NodeMap>::add_edge(u, v);
+            DirectedAdjacencyListGraph<Node, NodeMap>::add_edge(v, u);
         }
 
          /**
@@ -41,32 +42,64 @@ class UndirectedAdjacencyListGraph : public DirectedAdjacencyListGraph<Node> {
          * @param v O segundo nó da aresta a ser removida.
          */
         void remove_edge(const Node& u, const Node& v) override {
-            DirectedAdjacencyListGraph<Node>::remove_edge(u, v);
-            DirectedAdjacencyListGraph<Node>::remove_edge(v, u);
+            DirectedAdjacencyListGraph<Node, NodeMap>::remove_edge(u, v);
+            DirectedAdjacencyListGraph<Node, NodeMap>::remove_edge(v, u);
+        }
+
+         /**
+         * @brief Remove o nó 'node' e todas as arestas incidentes a ele.
+         *
+         * Como as arestas são simétricas, os nós que apontam para 'node' são exatamente os seus
+         * vizinhos. Por isso, apenas as listas dos vizinhos do nó removido e do último nó (que
+         * passa a ocupar o índice liberado) são visitadas, em vez de todas as listas do grafo.
+         *
+         * @param node O nó a ser removido.
+         */
+        void remove_node(const Node& node) override {
+            int index = this->get_index(node);
+            if (index == -1) {
+                return;
+            }
+            int last_index = static_cast<int>(this->index_to_node.size()) - 1;
+
+            /*Remove o nó das listas dos seus vizinhos, descontando os dois sentidos de cada aresta*/
+            for (int neighbor_index : this->adjac[index]) {
+                if (neighbor_index == index) {
+                    this->arc_count--;
+                    this->loop_count--;
+                    continue;
+                }
+                auto& neighbors = this->adjac[neighbor_index];
+                neighbors.erase(std::find(neighbors.begin(), neighbors.end(), index));
+                this->arc_count -= 2;
+            }
+
+            /*Renumera o último nó nas listas dos seus vizinhos (e no seu próprio laço, se houver)*/
+            if (index != last_index) {
+                for (int neighbor_index : this->adjac[last_index]) {
+                    auto& neighbors = this->adjac[neighbor_index];
+                    *std::find(neighbors.begin(), neighbors.end(), last_index) = index;
+                }
+            }
+
+            this->move_last_node_to(index);
         }
 
          /**
          * @brief Retorna o número de arestas não-direcionadas no grafo.
          *
-         * Como a classe base representa um grafo direcionado, o número de arestas
-         * é calculado dividindo o número de arestas direcionadas por dois.
+         * Como a classe base representa um grafo direcionado, cada aresta comum aparece como
+         * dois arcos, enquanto laços aparecem uma única vez. O cálculo usa os contadores de arcos
+         * e de laços mantidos pela classe base, custando O(1).
          *
          * @return O número total de arestas não-direcionadas.
          */
         size_t get_size() const override {
-           size_t directed_size = DirectedAdjacencyListGraph<Node>::get_size();
-           size_t loop_count = 0;
-
-            /* Procura por laços no grafo todo. Laços não são duplicados no grafo direcionado, 
-                então precisam ser contados apenas uma vez */
-           for(const auto& node : DirectedAdjacencyListGraph<Node>::get_nodes()) {
-               const auto& neighbors = DirectedAdjacencyListGraph<Node>::get_neighbors(node);
-               /*Caso um nó tenha ele mesmo como vizinho, conta como um laço*/
-               loop_count += std::count(neighbors.begin(), neighbors.end(), node);
-           }
+           size_t directed_size = DirectedAdjacencyListGraph<Node, NodeMap>::get_size();
+           assert(this->loop_count == this->count_loops() && "UndirectedAdjacencyListGraph: loop counter out of sync");
 
-           size_t regular_edges = (directed_size - loop_count) / 2;
-           return regular_edges + loop_count;
+           size_t regular_edges = (directed_size - this->loop_count) / 2;
+           return regular_edges + this->loop_count;
         }
 
 
@@ -89,5 +122,9 @@ class UndirectedAdjacencyListGraph : public DirectedAdjacencyListGraph<Node> {
             }
             return edges;
         }
+
+        bool is_directed() const override {
+            return false;
+        }
 };
 #endif // UNDIRECTEDADJACENCYLISTGRAPH_H
\ No newline at end of file
@@ -7,12 +7,13 @@
  * @class UndirectedAdjacencyMatrixGraph
  * @brief Implementação de um grafo não-direcionado usando uma matriz de adjacência.
  * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
  *
  * Herda de DirectedAdjacencyMatrixGraph para reutilizar a estrutura básica,
  * mas garante a simetria das arestas.
  */
-template<typename Node>
-class UndirectedAdjacencyMatrixGraph : public DirectedAdjacencyMatrixGraph<Node> {
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class UndirectedAdjacencyMatrixGraph : public DirectedAdjacencyMatrixGraph<Node, NodeMap> {
 public:
 
     /**
@@ -20,8 +21,10 @@ public:
      * @return O tamanho do grafo.
      */
     size_t get_size() const override {
-        // Como cada aresta é representada duas vezes (u,v) e (v,u), dividimos por 2.
-        return DirectedAdjacencyMatrixGraph<Node>::get_size() / 2;
+        // Cada aresta comum é representada duas vezes, (u,v) e (v,u), mas laços ocupam uma única célula.
+        size_t directed_size = DirectedAdjacencyMatrixGraph<Node, NodeMap>::get_size();
+        assert(this->loop_count == this->count_loops() && "UndirectedAdjacencyMatrixGraph: loop counter out of sync");
+        return (directed_size - this->loop_count) / 2 + this->loop_count;
     }
 
     /**
@@ -31,8 +34,8 @@ public:
      */
     void add_edge(const Node& from, const Node& to) override {
         // Adiciona a aresta nos dois sentidos para simular a não-direcionalidade.
-        DirectedAdjacencyMatrixGraph<Node>::add_edge(from, to);
-        DirectedAdjacencyMatrixGraph<Node>::add_edge(to, from);
+        DirectedAdjacencyMatrixGraph<Node, NodeMap>::add_edge(from, to);
+        DirectedAdjacencyMatrixGraph<Node, NodeMap>::add_edge(to, from);
     }
 
     /**
@@ -42,8 +45,8 @@ public:
      */
     void remove_edge(const Node& from, const Node& to) override {
         // Remove a aresta nos dois sentidos.
-        DirectedAdjacencyMatrixGraph<Node>::remove_edge(from, to);
-        DirectedAdjacencyMatrixGraph<Node>::remove_edge(to, from);
+        DirectedAdjacencyMatrixGraph<Node, NodeMap>::remove_edge(from, to);
+        DirectedAdjacencyMatrixGraph<Node, NodeMap>::remove_edge(to, from);
     }
 
     /**
@@ -119,6 +122,10 @@ public:
         }
         return edges;
     }
+
+    bool is_directed() const override {
+        return false;
+    }
 };
 
 #endif
@@ -0,0 +1,83 @@
+#ifndef UNDIRECTEDBITSETADJACENCYMATRIXGRAPH_H
+#define UNDIRECTEDBITSETADJACENCYMATRIXGRAPH_H
+
+#include "DirectedBitsetAdjacencyMatrixGraph.h"
+
+/**
+ * @class UndirectedBitsetAdjacencyMatrixGraph
+ * @brief Implementação de um grafo não-direcionado usando uma matriz de adjacência compactada em bits.
+ * @tparam Node O tipo de dado para cada nó do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
+ *
+ * Herda de DirectedBitsetAdjacencyMatrixGraph e mantém a matriz simétrica.
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class UndirectedBitsetAdjacencyMatrixGraph : public DirectedBitsetAdjacencyMatrixGraph<Node, NodeMap> {
+    using Base = DirectedBitsetAdjacencyMatrixGraph<Node, NodeMap>;
+
+public:
+    using Base::Base;
+
+    /**
+     * @brief Retorna o número de arestas não-direcionadas.
+     *
+     * Cada aresta ocupa dois bits, exceto os laços, que ocupam apenas a diagonal.
+     * @return O tamanho do grafo.
+     */
+    size_t get_size() const override {
+        size_t directed_size = Base::get_size();
+        assert(this->loop_count == this->count_loops() && "UndirectedBitsetAdjacencyMatrixGraph: loop counter out of sync");
+        return (directed_size - this->loop_count) / 2 + this->loop_count;
+    }
+
+    /**
+     * @brief Adiciona uma aresta não-direcionada entre dois nós.
+     * @param from O primeiro nó.
+     * @param to O segundo nó.
+     */
+    void add_edge(const Node& from, const Node& to) override {
+        // Adiciona a aresta nos dois sentidos para simular a não-direcionalidade.
+        Base::add_edge(from, to);
+        Base::add_edge(to, from);
+    }
+
+    /**
+     * @brief Remove uma aresta não-direcionada entre dois nós.
+     * @param from O primeiro nó.
+     * @param to O segundo nó.
+     */
+    void remove_edge(const Node& from, const Node& to) override {
+        // Remove a aresta nos dois sentidos.
+        Base::remove_edge(from, to);
+        Base::remove_edge(to, from);
+    }
+
+    /**
+     * @brief Calcula o grau de um nó.
+     * @param node O nó.
+     * @return O grau do nó.
+     */
+    size_t get_in_degree(const Node& node) const override {
+        // Em grafos não-direcionados, grau de entrada e saída são iguais.
+        return this->get_out_degree(node);
+    }
+
+    std::vector<EdgeIndex> get_all_edges() const override {
+        std::vector<EdgeIndex> edges;
+        for (size_t from_index = 0; from_index < this->get_order(); from_index++) {
+            this->for_each_neighbor(static_cast<int>(from_index), [&](int to_index) {
+                // Para evitar duplicatas, adiciona a aresta apenas uma vez, quando from_index <= to_index
+                if (from_index <= static_cast<size_t>(to_index)) {
+                    edges.push_back(EdgeIndex{static_cast<int>(from_index), to_index});
+                }
+            });
+        }
+        return edges;
+    }
+
+    bool is_directed() const override {
+        return false;
+    }
+};
+
+#endif
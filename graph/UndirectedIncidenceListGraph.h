@@ -0,0 +1,152 @@
+#ifndef UNDIRECTEDINCIDENCELISTGRAPH_H
+#define UNDIRECTEDINCIDENCELISTGRAPH_H
+
+#include "DirectedIncidenceListGraph.h"
+
+/**
+ * @class UndirectedIncidenceListGraph
+ * @brief Implementação esparsa de um grafo não-direcionado usando listas de incidência.
+ * @tparam Node O tipo de dado para cada nó.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
+ *
+ * Cada aresta {u, v} é armazenada uma única vez, como se fosse o arco (u, v): ela aparece
+ * na lista de saída de 'u' e na lista de entrada de 'v'. Os vizinhos de um nó são, portanto,
+ * os destinos das arestas da sua lista de saída mais as origens das arestas da sua lista
+ * de entrada. Laços aparecem nas duas listas do mesmo nó e são contados apenas uma vez.
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class UndirectedIncidenceListGraph : public DirectedIncidenceListGraph<Node, NodeMap> {
+    using Base = DirectedIncidenceListGraph<Node, NodeMap>;
+
+protected:
+    /**
+     * @brief Procura a aresta entre 'u_index' e 'v_index', em qualquer um dos sentidos.
+     * @return O identificador da aresta, ou -1 caso ela não exista.
+     */
+    int find_undirected_edge(int u_index, int v_index) const {
+        int edge_id = this->find_edge(u_index, v_index);
+        return edge_id != -1 ? edge_id : this->find_edge(v_index, u_index);
+    }
+
+public:
+    /**
+     * @brief Construtor padrão.
+     */
+    UndirectedIncidenceListGraph() = default;
+
+    /**
+     * @brief Adiciona uma aresta não-direcionada entre dois nós, caso ela ainda não exista.
+     * @param node1 O primeiro nó.
+     * @param node2 O segundo nó.
+     */
+    void add_edge(const Node& node1, const Node& node2) override {
+        if (!this->has_node(node1)) this->add_node(node1);
+        if (!this->has_node(node2)) this->add_node(node2);
+
+        int index1 = this->get_index(node1);
+        int index2 = this->get_index(node2);
+        if (find_undirected_edge(index1, index2) == -1) {
+            this->append_edge(index1, index2);
+        }
+    }
+
+    /**
+     * @brief Remove uma aresta não-direcionada entre dois nós.
+     * @param node1 O primeiro nó.
+     * @param node2 O segundo nó.
+     */
+    void remove_edge(const Node& node1, const Node& node2) override {
+        if (!this->has_node(node1) || !this->has_node(node2)) return;
+
+        int edge_id = find_undirected_edge(this->get_index(node1), this->get_index(node2));
+        if (edge_id != -1) {
+            this->remove_edge_by_id(edge_id);
+        }
+    }
+
+    /**
+     * @brief Percorre os índices dos vizinhos de um nó sem alocar memória.
+     * @param node_index O índice do nó.
+     * @param visit A função chamada para cada vizinho.
+     * @return false se a iteração foi interrompida, true caso contrário.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    bool for_each_neighbor(int node_index, NeighborVisitor visit) const override {
+        if (!Base::for_each_neighbor(node_index, visit)) {
+            return false;
+        }
+        for (int edge_id : this->in_edges[node_index]) {
+            int from_index = this->edges[edge_id].from;
+            // Laços já foram visitados pela lista de saída.
+            if (from_index != node_index && !visit(from_index)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Em grafos não-direcionados, os vizinhos de entrada são os próprios vizinhos.
+     */
+    bool for_each_in_neighbor(int node_index, NeighborVisitor visit) const override {
+        return for_each_neighbor(node_index, visit);
+    }
+
+    /**
+     * @brief Calcula o grau de um nó.
+     * @param node O nó.
+     * @return O grau do nó.
+     */
+    size_t get_in_degree(const Node& node) const override {
+        int node_index = this->get_index(node);
+        if (node_index == -1) return 0;
+
+        size_t degree = this->out_edges[node_index].size();
+        for (int edge_id : this->in_edges[node_index]) {
+            if (this->edges[edge_id].from != node_index) {
+                degree++;
+            }
+        }
+        return degree;
+    }
+
+    /**
+     * @brief Calcula o grau de um nó (sinônimo de get_in_degree).
+     * @param node O nó.
+     * @return O grau do nó.
+     */
+    size_t get_out_degree(const Node& node) const override {
+        return get_in_degree(node);
+    }
+
+    /**
+     * @brief Verifica se existe uma aresta entre 'u' e 'v'.
+     * @param u O primeiro nó.
+     * @param v O segundo nó.
+     * @return true se os nós são adjacentes, false caso contrário.
+     */
+    bool is_adjacent(const Node& u, const Node& v) const override {
+        int u_idx = this->get_index(u);
+        int v_idx = this->get_index(v);
+        if (u_idx == -1 || v_idx == -1) {
+            return false;
+        }
+        return find_undirected_edge(u_idx, v_idx) != -1;
+    }
+
+    std::vector<EdgeIndex> get_all_edges() const override {
+        std::vector<EdgeIndex> edges;
+        edges.reserve(this->edges.size());
+        // Cada aresta é devolvida uma única vez, com o menor índice primeiro.
+        for (const EdgeIndex& edge : this->edges) {
+            edges.push_back(EdgeIndex{std::min(edge.from, edge.to), std::max(edge.from, edge.to)});
+        }
+        return edges;
+    }
+
+    bool is_directed() const override {
+        return false;
+    }
+};
+
+#endif
@@ -9,11 +9,12 @@
  * @class UndirectedIncidenceMatrixGraph
  * @brief Implementação de um grafo não-direcionado usando uma matriz de incidência.
  * @tparam Node O tipo de dado para cada nó.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
  *
  * Herda de DirectedIncidenceMatrixGraph e adapta os métodos para um contexto não-direcionado.
  */
-template<typename Node>
-class UndirectedIncidenceMatrixGraph : public DirectedIncidenceMatrixGraph<Node> {
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class UndirectedIncidenceMatrixGraph : public DirectedIncidenceMatrixGraph<Node, NodeMap> {
 public:
     /**
      * @brief Construtor padrão.
@@ -50,13 +51,13 @@ public:
     }
 
     /**
-     * @brief Obtém os índices dos vizinhos de um nó.
+     * @brief Percorre os índices dos vizinhos de um nó sem alocar memória.
      * @param node_index O índice do nó.
-     * @return Um vetor com os índices dos vizinhos.
+     * @param visit A função chamada para cada vizinho.
+     * @return false se a iteração foi interrompida, true caso contrário.
      */
-    std::vector<int> get_neighbors_indices(int node_index) const override {
-        std::vector<int> neighbors_indices;
-        if (node_index < 0 || node_index >= static_cast<int>(this->get_order())) return neighbors_indices;
+    bool for_each_neighbor(int node_index, NeighborVisitor visit) const override {
+        if (node_index < 0 || node_index >= static_cast<int>(this->get_order())) return true;
 
         // Percorre cada aresta.
         for (const auto& edge_row : this->matrix) {
@@ -65,13 +66,22 @@ public:
                 // Procura pelo outro nó na mesma aresta.
                 for (size_t i = 0; i < this->get_order(); ++i) {
                     if (i != static_cast<size_t>(node_index) && edge_row[i] == 1) {
-                        neighbors_indices.push_back(i);
+                        if (!visit(static_cast<int>(i))) {
+                            return false;
+                        }
                         break;
                     }
                 }
             }
         }
-        return neighbors_indices;
+        return true;
+    }
+
+    /**
+     * @brief Em grafos não-direcionados, os vizinhos de entrada são os próprios vizinhos.
+     */
+    bool for_each_in_neighbor(int node_index, NeighborVisitor visit) const override {
+        return for_each_neighbor(node_index, visit);
     }
 
     /**
@@ -176,6 +186,10 @@ public:
         }
         return edges;
     }
+
+    bool is_directed() const override {
+        return false;
+    }
 };
 
 #endif
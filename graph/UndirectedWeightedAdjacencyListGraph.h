@@ -0,0 +1,117 @@
+#ifndef UNDIRECTEDWEIGHTEDADJACENCYLISTGRAPH_H
+#define UNDIRECTEDWEIGHTEDADJACENCYLISTGRAPH_H
+
+#include "DirectedWeightedAdjacencyListGraph.h"
+
+/**
+ * @class UndirectedWeightedAdjacencyListGraph
+ * @brief Grafo não-direcionado e ponderado usando listas de adjacência.
+ * @tparam Node O tipo de dado que será armazenado em cada vértice do grafo.
+ * @tparam NodeMap O mapeamento de nós para índices internos (veja NodeMap.h).
+ *
+ * Assim como UndirectedAdjacencyListGraph, herda da versão direcionada e armazena cada
+ * aresta nos dois sentidos, com o mesmo peso.
+ */
+template<typename Node, typename NodeMap = DefaultNodeMap<Node>>
+class UndirectedWeightedAdjacencyListGraph : public DirectedWeightedAdjacencyListGraph<Node, NodeMap> {
+    using Base = DirectedWeightedAdjacencyListGraph<Node, NodeMap>;
+
+    public:
+        using Base::add_edge;
+
+        /**
+         * @brief Adiciona uma aresta não-direcionada de peso unitário entre os nós 'u' e 'v'.
+         */
+        void add_edge(const Node& u, const Node& v) override {
+            Base::add_edge(u, v);
+            Base::add_edge(v, u);
+        }
+
+        /**
+         * @brief Adiciona uma aresta não-direcionada com peso entre os nós 'u' e 'v'.
+         *
+         * O peso é registrado nos dois sentidos da aresta.
+         */
+        void add_edge(const Node& u, const Node& v, double weight) override {
+            Base::add_edge(u, v, weight);
+            Base::add_edge(v, u, weight);
+        }
+
+        /**
+         * @brief Remove a aresta não-direcionada entre os nós 'u' e 'v', nos dois sentidos.
+         */
+        void remove_edge(const Node& u, const Node& v) override {
+            Base::remove_edge(u, v);
+            Base::remove_edge(v, u);
+        }
+
+        /**
+         * @brief Remove o nó 'node' e todas as arestas incidentes a ele.
+         *
+         * Assim como em UndirectedAdjacencyListGraph, apenas as listas dos vizinhos do nó removido
+         * e do último nó (que passa a ocupar o índice liberado) são visitadas.
+         */
+        void remove_node(const Node& node) override {
+            int index = this->get_index(node);
+            if (index == -1) {
+                return;
+            }
+            int last_index = static_cast<int>(this->index_to_node.size()) - 1;
+
+            for (const WeightedNeighbor& neighbor : this->adjac[index]) {
+                if (neighbor.index == index) {
+                    this->arc_count--;
+                    this->loop_count--;
+                    continue;
+                }
+                auto& neighbors = this->adjac[neighbor.index];
+                neighbors.erase(std::find_if(neighbors.begin(), neighbors.end(),
+                    [index](const WeightedNeighbor& other) { return other.index == index; }));
+                this->arc_count -= 2;
+            }
+
+            if (index != last_index) {
+                for (const WeightedNeighbor& neighbor : this->adjac[last_index]) {
+                    this->find_neighbor(neighbor.index, last_index)->index = index;
+                }
+            }
+
+            this->move_last_node_to(index);
+        }
+
+        /**
+         * @brief Retorna o número de arestas não-direcionadas no grafo.
+         *
+         * Laços aparecem uma única vez na lista do nó e por isso são contados separadamente,
+         * pelo contador de laços mantido na classe base.
+         */
+        size_t get_size() const override {
+            size_t directed_size = Base::get_size();
+            assert(this->loop_count == this->count_loops() && "UndirectedWeightedAdjacencyListGraph: loop counter out of sync");
+            return (directed_size - this->loop_count) / 2 + this->loop_count;
+        }
+
+        size_t get_in_degree(const Node& node) const override {
+            /*Em grafos não-direcionados, o grau de entrada é igual ao grau de saída*/
+            return this->get_out_degree(node);
+        }
+
+        std::vector<EdgeIndex> get_all_edges() const override {
+            std::vector<EdgeIndex> edges;
+            for (size_t from_index = 0; from_index < this->adjac.size(); from_index++) {
+                for (const WeightedNeighbor& neighbor : this->adjac[from_index]) {
+                    // Para evitar duplicatas, adiciona a aresta apenas se from_index for menor ou igual ao destino
+                    if (from_index <= static_cast<size_t>(neighbor.index)) {
+                        edges.push_back(EdgeIndex{static_cast<int>(from_index), neighbor.index});
+                    }
+                }
+            }
+            return edges;
+        }
+
+        bool is_directed() const override {
+            return false;
+        }
+};
+
+#endif // UNDIRECTEDWEIGHTEDADJACENCYLISTGRAPH_H
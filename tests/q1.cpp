@@ -5,6 +5,7 @@
 #include "../Kruskal.h"
 #include "../utils/GraphIO.h"
 #include "../graph/UndirectedAdjacencyListGraph.h"
+#include "../graph/UndirectedWeightedAdjacencyListGraph.h"
 
 int main() {
 
@@ -25,5 +26,16 @@ int main() {
 
     print_kruskal_result(result);
 
+    std::cout << "\nCreating weighted graph from file '" << filename << "'...\n";
+
+    UndirectedWeightedAdjacencyListGraph<int> weighted_graph;
+    populate_graph_weighted_from_file(filename, weighted_graph);
+    weighted_graph.print();
+
+    std::cout << "Running Kruskal's Algorithm on the weighted graph...\n";
+    auto weighted_result = kruskal(weighted_graph);
+
+    print_kruskal_result(weighted_result);
+
     return 0;
 }
@@ -0,0 +1,52 @@
+#include <iostream>
+#include <stdexcept>
+
+#include "../graph/DirectedWeightedAdjacencyListGraph.h"
+#include "../utils/GraphFormats.h"
+#include "../BellmanFord.h"
+
+int main() {
+    std::cout << "Creating the graph of 'digraph.txt' from the DIMACS file 'digraph.gr'...\n\n";
+    DirectedWeightedAdjacencyListGraph<int> graph_dimacs;
+    read_dimacs_file<int>("data/digraph.gr").build(graph_dimacs);
+    graph_dimacs.print();
+    print_bellman_ford_result(bellman_ford(graph_dimacs, 1), graph_dimacs);
+
+    std::cout << "Creating the same graph from the Matrix Market file 'digraph.mtx'...\n\n";
+    DirectedWeightedAdjacencyListGraph<int> graph_mtx;
+    read_matrix_market_file<int>("data/digraph.mtx").build(graph_mtx);
+    graph_mtx.print();
+    print_bellman_ford_result(bellman_ford(graph_mtx, 1), graph_mtx);
+
+    std::cout << "Creating the same graph from the SNAP file 'digraph.snap'...\n\n";
+    DirectedWeightedAdjacencyListGraph<int> graph_snap;
+    read_snap_file<int>("data/digraph.snap").build(graph_snap);
+    graph_snap.print();
+    print_bellman_ford_result(bellman_ford(graph_snap, 1), graph_snap);
+
+    /*Cada entrada "i j valor" gera também o arco de j para i com peso -valor*/
+    std::cout << "Creating a directed graph from the skew-symmetric file 'graph-skew.mtx'...\n\n";
+    DirectedWeightedAdjacencyListGraph<int> graph_skew;
+    read_matrix_market_file<int>("data/graph-skew.mtx").build(graph_skew);
+    graph_skew.print();
+    print_bellman_ford_result(bellman_ford(graph_skew, 1), graph_skew);
+
+    std::cout << "Reading 'graph-out-of-range.mtx', which has an entry outside its 3x3 matrix...\n";
+    try {
+        read_matrix_market_file<int>("data/graph-out-of-range.mtx");
+        std::cout << "The file was accepted.\n";
+    } catch (const std::runtime_error& error) {
+        std::cout << "Rejected: " << error.what() << "\n";
+    }
+
+    for (const char* filename : {"data/digraph-out-of-range.gr", "data/digraph-malformed.gr"}) {
+        std::cout << "Reading '" << filename << "'...\n";
+        try {
+            read_dimacs_file<int>(filename);
+            std::cout << "The file was accepted.\n";
+        } catch (const std::runtime_error& error) {
+            std::cout << "Rejected: " << error.what() << "\n";
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,266 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include <random>
+#include <algorithm>
+
+#include "../graph/BidirectionalAdjacencyListGraph.h"
+#include "../graph/CompressedSparseRowGraph.h"
+#include "../graph/GraphBuilder.h"
+#include "../graph/UndirectedAdjacencyListGraph.h"
+#include "../utils/GraphIO.h"
+#include "../utils/Bfs.h"
+#include "../utils/DirectionOptimizingBfs.h"
+#include "../utils/ParallelBfs.h"
+#include "../utils/MultiSourceBfs.h"
+#include "../utils/Dfs.h"
+#include "../utils/Components.h"
+#include "../utils/GraphAlgorithms.h"
+#include "../utils/StronglyConnectedComponents.h"
+
+/*Imprime uma sequência de nós em uma linha*/
+template<typename Node>
+void print_nodes(const std::string& title, const std::vector<Node>& nodes) {
+    std::cout << title << ":";
+    for (const Node& node : nodes) {
+        std::cout << " " << node;
+    }
+    std::cout << "\n";
+}
+
+/*Compara os níveis de uma busca com os de bfs_tree a partir da mesma origem*/
+void print_levels_check(const std::string& title, const BFSTree& tree, const BFSTree& expected) {
+    size_t reached = 0;
+    for (int level : expected.level) {
+        reached += level != -1;
+    }
+    std::cout << title << ": " << (tree.level == expected.level ? "OK" : "MISMATCH")
+              << " (" << reached << " nodes reached)\n";
+}
+
+/*Imprime os tempos de cada nó, na ordem dos índices, e as arestas de cada tipo*/
+template<typename Node>
+void print_dfs_result(const std::string& title, DFSResult<Node>& result, const IGraph<Node>& graph) {
+    std::cout << title << ":\n";
+    for (const Node& node : graph.get_nodes()) {
+        std::cout << "  " << node << " (" << result.discovery[node] << "/" << result.exit[node] << ")";
+    }
+    std::cout << "\n";
+    const std::pair<EdgeType, const char*> types[] = {
+        {EdgeType::TREE, "tree"}, {EdgeType::BACK, "back"}, {EdgeType::FORWARD, "forward"}, {EdgeType::CROSS, "cross"}};
+    for (const auto& [type, name] : types) {
+        std::cout << "  " << name << ":";
+        for (const Edge<Node>& edge : result.edges[type]) {
+            std::cout << " " << edge.from << "->" << edge.to;
+        }
+        std::cout << "\n";
+    }
+}
+
+/*Verifica se dois rótulos descrevem a mesma partição dos nós, mesmo com outra numeração*/
+bool same_partition(const ComponentLabels& a, const ComponentLabels& b) {
+    if (a.component.size() != b.component.size() || a.count() != b.count()) {
+        return false;
+    }
+    std::vector<int> a_to_b(a.count(), -1);
+    for (size_t i = 0; i < a.component.size(); ++i) {
+        int& mapped = a_to_b[a.component[i]];
+        if (mapped == -1) {
+            mapped = b.component[i];
+        } else if (mapped != b.component[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/*Gera um grafo direcionado aleatório, sempre o mesmo para a mesma semente*/
+GraphBuilder<int> random_digraph(int order, size_t arc_count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick(0, order - 1);
+    GraphBuilder<int> builder(true);
+    for (int i = 0; i < order; ++i) {
+        builder.add_node(i);
+    }
+    builder.reserve_edges(arc_count);
+    for (size_t k = 0; k < arc_count; ++k) {
+        builder.add_edge_indices(pick(rng), pick(rng));
+    }
+    return builder;
+}
+
+int main() {
+    std::cout << "Creating a directed graph from file 'digraph.txt'...\n\n";
+    auto builder = read_edge_list_file<int>("data/digraph.txt", true);
+    BidirectionalAdjacencyListGraph<int> graph_bidirectional;
+    builder.build(graph_bidirectional);
+    CompressedSparseRowGraph<int> graph_csr(builder);
+
+    print_nodes("bfs from 1", bfs(graph_bidirectional, 1));
+    print_nodes("parallel_bfs from 1", parallel_bfs(graph_bidirectional, 1, 4));
+    auto components = bfs_digraph(graph_bidirectional);
+    for (size_t i = 0; i < components.size(); ++i) {
+        print_nodes("bfs_digraph tree " + std::to_string(i + 1), components[i]);
+    }
+    auto parallel_components = parallel_bfs_digraph(graph_bidirectional, 4);
+    for (size_t i = 0; i < parallel_components.size(); ++i) {
+        print_nodes("parallel_bfs_digraph tree " + std::to_string(i + 1), parallel_components[i]);
+    }
+    std::cout << "\n";
+
+    DFSResult<int> dfs_result = dfs(graph_bidirectional);
+    print_dfs_result("dfs (discovery/exit)", dfs_result, graph_bidirectional);
+    DFSResult<int> dfs_index_result = dfs_indices(graph_bidirectional, true).to_result();
+    print_dfs_result("dfs_indices(graph, true).to_result() (discovery/exit)", dfs_index_result, graph_bidirectional);
+    std::cout << "\n";
+
+    /*Com has_in_neighbor_access, a etapa bottom-up usa as listas de entrada do grafo; sem ela, um CSR próprio*/
+    int start = graph_bidirectional.get_index(1);
+    print_levels_check("direction_optimizing_bfs (bidirectional) vs bfs_tree",
+                       direction_optimizing_bfs(graph_bidirectional, 1), bfs_tree(graph_bidirectional, start));
+    print_levels_check("direction_optimizing_bfs (CSR) vs bfs_tree",
+                       direction_optimizing_bfs(graph_csr, 1), bfs_tree(graph_csr, graph_csr.get_index(1)));
+
+    std::cout << "\nCreating a random digraph with 20000 nodes and 160000 arcs...\n";
+    GraphBuilder<int> random_builder = random_digraph(20000, 160000, 42);
+    BidirectionalAdjacencyListGraph<int> random_bidirectional;
+    random_builder.build(random_bidirectional);
+    CompressedSparseRowGraph<int> random_csr(random_builder);
+    print_levels_check("direction_optimizing_bfs (bidirectional) vs bfs_tree",
+                       direction_optimizing_bfs(random_bidirectional, 0), bfs_tree(random_bidirectional, 0));
+    print_levels_check("direction_optimizing_bfs (CSR) vs bfs_tree",
+                       direction_optimizing_bfs(random_csr, 0), bfs_tree(random_csr, 0));
+
+    /*Fronteiras com pelo menos 1024 nós são expandidas pelas 4 threads*/
+    BFSTree random_tree = bfs_tree(random_csr, 0);
+    std::vector<size_t> level_sizes;
+    for (int level : random_tree.level) {
+        if (level >= 0) {
+            level_sizes.resize(std::max(level_sizes.size(), static_cast<size_t>(level) + 1));
+            level_sizes[level]++;
+        }
+    }
+    std::cout << "Largest frontier: " << *std::max_element(level_sizes.begin(), level_sizes.end()) << " nodes\n";
+    print_levels_check("parallel_bfs_tree (4 threads) vs bfs_tree", parallel_bfs_tree(random_csr, 0, 4), random_tree);
+
+    /*130 origens ocupam três lotes de 64, e o nó 0 aparece duas vezes no primeiro lote e uma no segundo*/
+    std::vector<int> sources;
+    for (int i = 0; i < 127; ++i) {
+        sources.push_back(i * 150);
+    }
+    sources.insert(sources.begin() + 5, 0);
+    sources.insert(sources.begin() + 100, 0);
+    sources.push_back(19999);
+    auto source_levels = multi_source_bfs(random_csr, sources);
+    size_t matching_sources = 0;
+    for (size_t k = 0; k < sources.size(); ++k) {
+        matching_sources += source_levels[k] == bfs_tree(random_csr, random_csr.get_index(sources[k])).level;
+    }
+    std::cout << "multi_source_bfs vs bfs_tree: " << (matching_sources == sources.size() ? "OK" : "MISMATCH")
+              << " (" << matching_sources << " of " << sources.size() << " sources)\n";
+
+    /*A DFS usa uma pilha explícita, então a profundidade do caminho não depende da pilha de chamadas*/
+    const int path_order = 1000000;
+    std::cout << "\nCreating a directed path with " << path_order << " nodes...\n";
+    GraphBuilder<int> path_builder(true);
+    for (int i = 0; i < path_order; ++i) {
+        path_builder.add_node(i);
+    }
+    path_builder.reserve_edges(path_order - 1);
+    for (int i = 0; i + 1 < path_order; ++i) {
+        path_builder.add_edge_indices(i, i + 1);
+    }
+    CompressedSparseRowGraph<int> path_csr(path_builder);
+    DFSResult<int> path_result = dfs(path_csr);
+    /*No caminho, o nó i é descoberto no tempo i + 1 e sai no tempo 2n - i*/
+    bool path_ok = true;
+    for (int i = 0; i < path_order; ++i) {
+        path_ok = path_ok && path_result.discovery[i] == i + 1 && path_result.exit[i] == 2 * path_order - i;
+    }
+    for (int node : {0, path_order / 2, path_order - 1}) {
+        std::cout << "Node " << node << ": discovery " << path_result.discovery[node]
+                  << ", exit " << path_result.exit[node] << "\n";
+    }
+    std::cout << "Tree edges: " << path_result.edges[EdgeType::TREE].size() << "\n";
+    std::cout << "dfs on the path: " << (path_ok ? "OK" : "MISMATCH") << "\n";
+
+    std::cout << "\nCreating an undirected graph from file 'graph-components.txt'...\n";
+    UndirectedAdjacencyListGraph<int> graph_components;
+    populate_graph_from_file("data/graph-components.txt", graph_components);
+    auto groups = connected_components(graph_components).groups(graph_components);
+    auto bfs_groups = bfs_digraph(graph_components);
+    for (size_t i = 0; i < groups.size(); ++i) {
+        print_nodes("connected_components group " + std::to_string(i + 1), groups[i]);
+    }
+    for (size_t i = 0; i < bfs_groups.size(); ++i) {
+        print_nodes("bfs_digraph tree " + std::to_string(i + 1), bfs_groups[i]);
+    }
+    /*Os grupos vêm em ordem de índice e as árvores da BFS em ordem de visita, então as árvores são ordenadas*/
+    bool groups_ok = groups.size() == bfs_groups.size();
+    for (size_t i = 0; groups_ok && i < groups.size(); ++i) {
+        std::vector<int> indices;
+        for (int node : bfs_groups[i]) {
+            indices.push_back(graph_components.get_index(node));
+        }
+        std::sort(indices.begin(), indices.end());
+        std::vector<int> group_indices;
+        for (int node : groups[i]) {
+            group_indices.push_back(graph_components.get_index(node));
+        }
+        groups_ok = indices == group_indices;
+    }
+    std::cout << "connected_components vs bfs_digraph: " << (groups_ok ? "OK" : "MISMATCH") << "\n";
+
+    UndirectedAdjacencyListGraph<int> graph_connected;
+    populate_graph_from_file("data/graph.txt", graph_connected);
+    std::cout << "is_connected('graph.txt'): " << (is_connected(graph_connected) ? "yes" : "no") << "\n";
+    std::cout << "is_connected('graph-components.txt'): " << (is_connected(graph_components) ? "yes" : "no") << "\n";
+
+    std::cout << "\nStrongly connected components of 'digraph.txt'...\n";
+    ComponentLabels tarjan = tarjan_scc(graph_bidirectional);
+    ComponentLabels parallel = parallel_scc(graph_bidirectional, 4);
+    auto tarjan_groups = tarjan.groups(graph_bidirectional);
+    for (size_t i = 0; i < tarjan_groups.size(); ++i) {
+        print_nodes("tarjan_scc component " + std::to_string(i), tarjan_groups[i]);
+    }
+    auto parallel_groups = parallel.groups(graph_bidirectional);
+    for (size_t i = 0; i < parallel_groups.size(); ++i) {
+        print_nodes("parallel_scc component " + std::to_string(i), parallel_groups[i]);
+    }
+    std::cout << "tarjan_scc vs parallel_scc: " << (same_partition(tarjan, parallel) ? "OK" : "MISMATCH") << "\n";
+    std::cout << "Condensation (nodes are tarjan_scc components):\n";
+    condensation(graph_bidirectional, tarjan).print();
+
+    /*Ciclos de 10 nós, ligados entre si por arcos que só avançam, com os nós numerados ao acaso.
+      Nenhum nó é podado e o pivô leva um só ciclo, então mais de 16384 nós chegam à coloração*/
+    const int cycle_count = 4000, cycle_length = 10;
+    std::cout << "Creating a digraph with " << cycle_count << " cycles of " << cycle_length << " nodes...\n";
+    std::vector<int> label(cycle_count * cycle_length);
+    for (size_t i = 0; i < label.size(); ++i) {
+        label[i] = static_cast<int>(i);
+    }
+    std::mt19937 rng(7);
+    std::shuffle(label.begin(), label.end(), rng);
+    GraphBuilder<int> cycles_builder(true);
+    for (int i = 0; i < static_cast<int>(label.size()); ++i) {
+        cycles_builder.add_node(i);
+    }
+    std::uniform_int_distribution<int> pick_cycle(0, cycle_count - 1);
+    for (int c = 0; c < cycle_count; ++c) {
+        for (int k = 0; k < cycle_length; ++k) {
+            cycles_builder.add_edge_indices(label[c * cycle_length + k], label[c * cycle_length + (k + 1) % cycle_length]);
+        }
+        int target = pick_cycle(rng);
+        if (target > c) {
+            cycles_builder.add_edge_indices(label[c * cycle_length], label[target * cycle_length]);
+        }
+    }
+    CompressedSparseRowGraph<int> cycles_csr(cycles_builder);
+    ComponentLabels cycles_tarjan = tarjan_scc(cycles_csr);
+    ComponentLabels cycles_parallel = parallel_scc(cycles_csr, 4);
+    std::cout << "Components: " << cycles_tarjan.count() << " (tarjan_scc), " << cycles_parallel.count()
+              << " (parallel_scc)\n";
+    std::cout << "tarjan_scc vs parallel_scc: " << (same_partition(cycles_tarjan, cycles_parallel) ? "OK" : "MISMATCH")
+              << "\n";
+    return 0;
+}
@@ -0,0 +1,67 @@
+#include <iostream>
+#include <string>
+#include <stdexcept>
+
+#include "../graph/DirectedAdjacencyListGraph.h"
+#include "../graph/DirectedWeightedAdjacencyListGraph.h"
+#include "../graph/StringPool.h"
+#include "../utils/GraphIO.h"
+
+int main() {
+    std::cout << "Interning labels in a StringPool...\n";
+    StringPool pool;
+    InternedString alice = pool.intern("alice");
+    InternedString alice_again = pool.intern(std::string("ali") + "ce");
+    InternedString bob = pool.intern("bob");
+    std::cout << "alice: id " << alice.id() << ", again: id " << alice_again.id() << ", same label: "
+              << (alice == alice_again ? "yes" : "no") << "\n";
+    std::cout << "bob: id " << bob.id() << ", text '" << bob << "'\n";
+    std::cout << "Labels in the pool: " << pool.size() << "\n";
+    std::cout << "find(\"carol\") before reading the file: " << (pool.find("carol").valid() ? "valid" : "invalid")
+              << "\n\n";
+
+    /*Os rótulos já internados mantêm os seus identificadores; os novos seguem a ordem do arquivo*/
+    std::cout << "Creating a weighted graph from the labelled file 'graph-labelled.txt'...\n\n";
+    DirectedWeightedAdjacencyListGraph<InternedString> graph_weighted;
+    load_labelled_edge_list_file("data/graph-labelled.txt", graph_weighted, pool);
+    graph_weighted.print();
+    std::cout << "Labels in the pool: " << pool.size() << "\n";
+
+    InternedString dave = pool.find("https://example.org/dave");
+    int dave_index = graph_weighted.get_index(dave);
+    int alice_index = graph_weighted.get_index(alice);
+    std::cout << "Index of 'https://example.org/dave': " << dave_index << ", node at that index: '"
+              << graph_weighted.get_node(dave_index) << "'\n";
+    std::cout << "Index of 'alice': " << alice_index << ", node at that index: '"
+              << graph_weighted.get_node(alice_index) << "'\n";
+    std::cout << "Weight alice -> bob (last weight in the file): "
+              << graph_weighted.get_weight(alice_index, graph_weighted.get_index(bob)) << "\n";
+    std::cout << "Weight carol -> alice (line without weight): "
+              << graph_weighted.get_weight(graph_weighted.get_index(pool.find("carol")), alice_index) << "\n";
+    std::cout << "Index of a label that is not in the graph: " << graph_weighted.get_index(pool.intern("erin"))
+              << "\n\n";
+
+    std::cout << "Creating an unweighted graph from the same file with a new pool...\n\n";
+    StringPool other_pool;
+    DirectedAdjacencyListGraph<InternedString> graph_list;
+    load_labelled_edge_list_file("data/graph-labelled.txt", graph_list, other_pool);
+    graph_list.print();
+
+    /*Um InternedString criado sem pool não pode ser um nó*/
+    std::cout << "Adding an invalid label as a node...\n";
+    try {
+        graph_list.add_node(InternedString());
+    } catch (const std::out_of_range& error) {
+        std::cout << "Rejected: " << error.what() << "\n";
+    }
+    std::cout << "Order after the rejected label: " << graph_list.get_order() << "\n\n";
+
+    /*Com nós std::string, create_nodes gera os rótulos "1", "2", ..., "n"*/
+    std::cout << "Creating a graph with std::string nodes from file 'graph-cycle-8.txt'...\n\n";
+    DirectedAdjacencyListGraph<std::string> graph_string;
+    populate_graph_from_file("data/graph-cycle-8.txt", graph_string);
+    graph_string.print();
+    std::cout << "Index of node \"3\": " << graph_string.get_index("3") << ", node at index 0: \""
+              << graph_string.get_node(0) << "\"\n";
+    return 0;
+}
@@ -6,6 +6,7 @@
 #include "../Prim.h"
 #include "../utils/GraphIO.h"
 #include "../graph/UndirectedAdjacencyListGraph.h"
+#include "../graph/UndirectedWeightedAdjacencyListGraph.h"
 
 /**
  * @brief Função principal para testar o algoritmo de Prim.
@@ -31,5 +32,17 @@ int main() {
 
     print_prim_result(result);
 
+    std::cout << "\nCreating weighted graph from file '" << filename << "'...\n";
+
+    UndirectedWeightedAdjacencyListGraph<int> weighted_graph;
+    populate_graph_weighted_from_file(filename, weighted_graph);
+    weighted_graph.print();
+
+    std::cout << "Running Prim's Algorithm on the weighted graph starting from node '" << start_node << "'...\n";
+
+    auto weighted_result = prim(weighted_graph, start_node);
+
+    print_prim_result(weighted_result);
+
     return 0;
 }
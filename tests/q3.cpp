@@ -6,6 +6,8 @@
 #include "../graph/UndirectedAdjacencyMatrixGraph.h"
 #include "../graph/IGraph.h"
 #include "../utils/GraphIO.h"
+#include "../utils/EdgeListParser.h"
+#include "../graph/UndirectedWeightedAdjacencyListGraph.h"
 #include "../Boruvka.h"
 
 template<typename Node>
@@ -27,5 +29,12 @@ int main() {
     auto result_und = boruvka(graph_und, weights_und);
     print_result(result_und);
 
+    std::cout << "\nCreating weighted graph from file 'graph.txt'...\n";
+    UndirectedWeightedAdjacencyListGraph<int> graph_weighted;
+    populate_graph_weighted_streaming("data/graph.txt", graph_weighted);
+    graph_weighted.print();
+    auto result_weighted = boruvka(graph_weighted);
+    print_result(result_weighted);
+
     return 0;
 }
@@ -1,15 +1,27 @@
 #include <iostream>
 #include <iomanip>
 #include <limits>
+#include <fstream>
+#include <string>
+#include <cstring>
+#include <cstddef>
+#include <iterator>
 
 #include "../graph/DirectedAdjacencyMatrixGraph.h"
 #include "../graph/UndirectedAdjacencyMatrixGraph.h"
 #include "../graph/IGraph.h"
 #include "../utils/GraphIO.h"
+#include "../utils/EdgeListParser.h"
+#include "../utils/GraphSnapshot.h"
+#include "../graph/DirectedWeightedAdjacencyListGraph.h"
+#include "../graph/CompressedSparseRowGraph.h"
 #include "../Djikstra.h"
 
 template<typename Node>
 void print_result(const IGraph<Node>& graph, DjikstraResult& result) {
+    if (skip_pretty_print("Shortest distances from the start node", graph.get_order())) {
+        return;
+    }
     std::cout << "Shortest distances from the start node:\n";
 
     // Tamanho fixo para alinhamento
@@ -75,5 +87,57 @@ int main() {
     auto result_und = djikstra(graph_und, weights_und, 1);
     print_result(graph_und, result_und);
 
+    std::cout << "\nCreating weighted graph from file 'digraph.txt'...\n";
+    DirectedWeightedAdjacencyListGraph<int> graph_weighted;
+    load_edge_list_file("data/digraph.txt", graph_weighted);
+    graph_weighted.print();
+    auto result_weighted = djikstra(graph_weighted, 1);
+    print_result(graph_weighted, result_weighted);
+
+    std::cout << "\nConverting weighted graph to CSR...\n";
+    CompressedSparseRowGraph<int> graph_csr(graph_weighted);
+    graph_csr.print();
+    auto result_csr = djikstra(graph_csr, 1);
+    print_result(graph_csr, result_csr);
+
+    std::cout << "\nSaving weighted graph snapshot and loading it back...\n";
+    save_graph_snapshot(graph_weighted, "build/digraph.snap");
+    SnapshotGraph<int> graph_snapshot("build/digraph.snap");
+    graph_snapshot.verify();
+    graph_snapshot.print();
+    auto result_snapshot = djikstra(graph_snapshot, 1);
+    print_result(graph_snapshot, result_snapshot);
+
+    /*Corrompe cópias do snapshot: uma declara 2^62 nós no cabeçalho, a outra aponta um vizinho para o nó 1000*/
+    std::cout << "\nOpening corrupted copies of the snapshot...\n";
+    std::ifstream original("build/digraph.snap", std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(original)), std::istreambuf_iterator<char>());
+    SnapshotHeader header;
+    std::memcpy(&header, bytes.data(), sizeof(header));
+
+    std::string huge_order = bytes;
+    uint64_t order = uint64_t(1) << 62;
+    std::memcpy(&huge_order[offsetof(SnapshotHeader, order)], &order, sizeof(order));
+    std::ofstream("build/digraph-huge-order.snap", std::ios::binary) << huge_order;
+    try {
+        SnapshotGraph<int> graph_huge("build/digraph-huge-order.snap");
+        std::cout << "The snapshot was accepted.\n";
+    } catch (const std::runtime_error& error) {
+        std::cout << "Rejected: " << error.what() << "\n";
+    }
+
+    std::string bad_neighbor = bytes;
+    auto layout = snapshot_format::layout<int>(header.order, header.arc_count, true);
+    int32_t neighbor = 1000;
+    std::memcpy(&bad_neighbor[layout.neighbors], &neighbor, sizeof(neighbor));
+    std::ofstream("build/digraph-bad-neighbor.snap", std::ios::binary) << bad_neighbor;
+    SnapshotGraph<int> graph_bad("build/digraph-bad-neighbor.snap");
+    try {
+        graph_bad.verify();
+        std::cout << "The snapshot was verified.\n";
+    } catch (const std::runtime_error& error) {
+        std::cout << "Rejected by verify: " << error.what() << "\n";
+    }
+
     return 0;
 }
@@ -5,7 +5,11 @@
 #include "../graph/DirectedAdjacencyListGraph.h"
 #include "../graph/DirectedAdjacencyMatrixGraph.h"
 #include "../graph/DirectedIncidenceMatrixGraph.h"
+#include "../graph/DirectedIncidenceListGraph.h"
+#include "../graph/CompressedSparseRowGraph.h"
+#include "../graph/DirectedWeightedAdjacencyListGraph.h"
 #include "../utils/GraphIO.h"
+#include "../utils/PipelinedLoader.h"
 #include "../BellmanFord.h"
 
 int main() {
@@ -32,5 +36,46 @@ int main() {
     auto result_incidence = bellman_ford(graph_incidence, weights, 1);
     print_bellman_ford_result(result_incidence, graph_incidence);
 
+    DirectedIncidenceListGraph<int> graph_incidence_list;
+    populate_graph_weighted_from_file("data/digraph.txt", graph_incidence_list, weights);
+    graph_incidence_list.print();
+    print_weights_matrix(weights, graph_incidence_list);
+    auto result_incidence_list = bellman_ford(graph_incidence_list, weights, 1);
+    print_bellman_ford_result(result_incidence_list, graph_incidence_list);
+
+    CompressedSparseRowGraph<int> graph_csr(graph_list);
+    graph_csr.print();
+    auto result_csr = bellman_ford(graph_csr, weights, 1);
+    print_bellman_ford_result(result_csr, graph_csr);
+
+    DirectedWeightedAdjacencyListGraph<int> graph_weighted;
+    populate_graph_weighted_from_file("data/digraph.txt", graph_weighted, LoadMode::PIPELINED);
+    graph_weighted.print();
+    auto result_weighted = bellman_ford(graph_weighted, 1);
+    print_bellman_ford_result(result_weighted, graph_weighted);
+
+    /*A linha "2,3" não tem peso: todos os leitores devem criar o arco com peso 1, e o arco 1->2
+      deve ficar com o último peso informado*/
+    std::cout << "Reading 'graph-mixed-weights.txt', with weighted and unweighted lines, in each mode...\n\n";
+    DirectedWeightedAdjacencyListGraph<int> graph_mixed_serial;
+    populate_graph_weighted_from_file("data/graph-mixed-weights.txt", graph_mixed_serial, LoadMode::SERIAL);
+    std::cout << "SERIAL: ";
+    graph_mixed_serial.print();
+
+    DirectedWeightedAdjacencyListGraph<int> graph_mixed_pipelined;
+    populate_graph_weighted_from_file("data/graph-mixed-weights.txt", graph_mixed_pipelined, LoadMode::PIPELINED);
+    std::cout << "PIPELINED: ";
+    graph_mixed_pipelined.print();
+
+    DirectedWeightedAdjacencyListGraph<int> graph_mixed_parallel;
+    load_edge_list_file("data/graph-mixed-weights.txt", graph_mixed_parallel);
+    std::cout << "Parallel parser: ";
+    graph_mixed_parallel.print();
+
+    DirectedWeightedAdjacencyListGraph<int> graph_mixed_streaming;
+    populate_graph_weighted_streaming("data/graph-mixed-weights.txt", graph_mixed_streaming);
+    std::cout << "Streaming: ";
+    graph_mixed_streaming.print();
+
     return 0;
 }
\ No newline at end of file
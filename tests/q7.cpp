@@ -6,6 +6,7 @@
 #include "../graph/UndirectedAdjacencyMatrixGraph.h"
 #include "../graph/IGraph.h"
 #include "../utils/GraphIO.h"
+#include "../graph/DirectedWeightedAdjacencyListGraph.h"
 #include "../FloydWarshall.h"
 
 int main() {
@@ -31,5 +32,20 @@ int main() {
     auto results2 = floyd_warshall(graph2, weights2);
     print_floyd_warshall_result(results2, graph2);
 
+    // Exportação das matrizes em CSV, sem a formatação de tabela
+    std::cout << "Distances Matrix (CSV):\n";
+    write_distances_matrix(results2.distances, graph2, std::cout);
+    std::cout << "\nPredecessors Matrix (CSV):\n";
+    write_predecessors_matrix(results2.predecessors, graph2, std::cout);
+    std::cout << std::endl;
+
+    // Teste do algoritmo de Floyd-Warshall com os pesos armazenados no próprio grafo
+    std::cout << "Creating weighted graph from file 'digraph-floyd-warshall.txt'...\n";
+    DirectedWeightedAdjacencyListGraph<char> graph_weighted;
+    populate_graph_weighted_from_file("data/digraph-floyd-warshall.txt", graph_weighted);
+    graph_weighted.print();
+    auto results_weighted = floyd_warshall(graph_weighted);
+    print_floyd_warshall_result(results_weighted, graph_weighted);
+
     return 0;
 }
\ No newline at end of file
@@ -6,6 +6,8 @@
 #include "../graph/UndirectedAdjacencyMatrixGraph.h"
 #include "../graph/UndirectedAdjacencyListGraph.h"
 #include "../graph/UndirectedIncidenceMatrixGraph.h"
+#include "../graph/UndirectedIncidenceListGraph.h"
+#include "../graph/UndirectedBitsetAdjacencyMatrixGraph.h"
 #include "../utils/GraphIO.h"
 #include <iostream>
 
@@ -26,5 +28,15 @@ int main() {
     populate_graph_from_file("data/graph-cycle-8.txt", graph_incidence);
     graph_incidence.print();
     print_hierholzer_result(hierholzer_undirected(graph_incidence));
+
+    UndirectedIncidenceListGraph<int> graph_incidence_list;
+    populate_graph_from_file("data/graph-cycle-8.txt", graph_incidence_list);
+    graph_incidence_list.print();
+    print_hierholzer_result(hierholzer_undirected(graph_incidence_list));
+
+    UndirectedBitsetAdjacencyMatrixGraph<int> graph_bitset;
+    populate_graph_from_file("data/graph-cycle-8.txt", graph_bitset);
+    graph_bitset.print();
+    print_hierholzer_result(hierholzer_undirected(graph_bitset));
     return 0;
 }
\ No newline at end of file
@@ -5,7 +5,12 @@
 #include "../Hierholzer.h"
 #include "../graph/DirectedAdjacencyMatrixGraph.h"
 #include "../graph/DirectedAdjacencyListGraph.h"
+#include "../graph/BidirectionalAdjacencyListGraph.h"
 #include "../graph/DirectedIncidenceMatrixGraph.h"
+#include "../graph/DirectedIncidenceListGraph.h"
+#include "../graph/DirectedBitsetAdjacencyMatrixGraph.h"
+#include "../graph/CompressedAdjacencyGraph.h"
+#include "../graph/GraphBuilder.h"
 #include "../utils/GraphIO.h"
 
 
@@ -22,9 +27,81 @@ int main() {
     graph_list.print();
     print_hierholzer_result(hierholzer_directed(graph_list));
 
+    BidirectionalAdjacencyListGraph<char> graph_bidirectional;
+    read_edge_list_file<char>("data/graph-path-9.txt", true).build(graph_bidirectional);
+    graph_bidirectional.print();
+    print_hierholzer_result(hierholzer_directed(graph_bidirectional));
+
     DirectedIncidenceMatrixGraph<char> graph_incidence;
     populate_graph_from_file("data/graph-path-9.txt", graph_incidence);
     graph_incidence.print();
     print_hierholzer_result(hierholzer_directed(graph_incidence));
+
+    DirectedIncidenceListGraph<char> graph_incidence_list;
+    populate_graph_from_file("data/graph-path-9.txt", graph_incidence_list);
+    graph_incidence_list.print();
+    print_hierholzer_result(hierholzer_directed(graph_incidence_list));
+
+    DirectedBitsetAdjacencyMatrixGraph<char> graph_bitset;
+    populate_graph_from_file("data/graph-path-9.txt", graph_bitset);
+    graph_bitset.print();
+    print_hierholzer_result(hierholzer_directed(graph_bitset));
+
+    CompressedAdjacencyGraph<char> graph_compressed(graph_list);
+    graph_compressed.print();
+    print_hierholzer_result(hierholzer_directed(graph_compressed));
+
+    /*Nós char acima de 127 são negativos quando char tem sinal, e precisam continuar válidos*/
+    std::cout << "\nAdding node 0xE9 to the adjacency list graph...\n";
+    const char accented = static_cast<char>(0xE9);
+    DirectedAdjacencyListGraph<char> graph_extended = graph_list;
+    graph_extended.add_edge(accented, graph_list.get_node(0));
+    std::cout << "Order: " << graph_extended.get_order() << ", size: " << graph_extended.get_size() << "\n";
+    std::cout << "Index of node 0xE9: " << graph_extended.get_index(accented) << "\n";
+    std::cout << "Arc 0xE9 -> " << graph_list.get_node(0) << ": "
+              << (graph_extended.is_adjacent(accented, graph_list.get_node(0)) ? "yes" : "no") << "\n";
+    graph_extended.remove_node(accented);
+    std::cout << "After removing 0xE9, order: " << graph_extended.get_order() << ", size: "
+              << graph_extended.get_size() << "\n";
+
+    /*Os nós int 1..n do cabeçalho usam o vetor de DenseNodeMap no lugar da tabela hash*/
+    std::cout << "\nCreating graphs with DenseNodeMap<int> from file 'digraph.txt'...\n\n";
+    GraphBuilder<int, DenseNodeMap<int>> dense_builder = read_edge_list_file<int>("data/digraph.txt", true);
+    DirectedAdjacencyListGraph<int, DenseNodeMap<int>> dense_list;
+    dense_builder.build(dense_list);
+    DirectedAdjacencyMatrixGraph<int, DenseNodeMap<int>> dense_matrix;
+    dense_builder.build(dense_matrix);
+    dense_list.print();
+    std::cout << "Matrix order: " << dense_matrix.get_order() << ", size: " << dense_matrix.get_size() << "\n";
+
+    std::cout << "\nRemoving node 1 from both graphs...\n";
+    dense_list.remove_node(1);
+    dense_matrix.remove_node(1);
+    dense_list.print();
+    std::cout << "Matrix order: " << dense_matrix.get_order() << ", size: " << dense_matrix.get_size() << "\n";
+    std::cout << "Index of node 1: " << dense_list.get_index(1) << " (list), " << dense_matrix.get_index(1)
+              << " (matrix)\n";
+    std::cout << "Index of node 19: " << dense_list.get_index(19) << " (list), " << dense_matrix.get_index(19)
+              << " (matrix)\n";
+
+    /*O vetor é indexado pelo valor do nó, então nós int negativos são rejeitados*/
+    std::cout << "\nAdding node -3 to the DenseNodeMap<int> graphs and builder...\n";
+    try {
+        dense_list.add_node(-3);
+    } catch (const std::out_of_range& error) {
+        std::cout << "List: " << error.what() << "\n";
+    }
+    try {
+        dense_matrix.add_edge(-3, 2);
+    } catch (const std::out_of_range& error) {
+        std::cout << "Matrix: " << error.what() << "\n";
+    }
+    try {
+        dense_builder.add_edge(2, -3);
+    } catch (const std::out_of_range& error) {
+        std::cout << "Builder: " << error.what() << "\n";
+    }
+    std::cout << "Orders after the rejected nodes: " << dense_list.get_order() << " (list), "
+              << dense_matrix.get_order() << " (matrix), " << dense_builder.get_order() << " (builder)\n";
     return 0;
 }
\ No newline at end of file
@@ -37,13 +37,13 @@ std::vector<Node> bfs_visit(const IGraph<Node>& graph, int start_index, std::vec
         queue.pop();
 
         /*Para o nó atual, marca seus vizinhos como visitados caso ainda não tenham sido visitados*/
-        for(size_t neighbor_index : graph.get_neighbors_indices(current)) {
+        graph.for_each_neighbor(current, [&](int neighbor_index) {
             if (visited[neighbor_index] == 0) {
                 visited[neighbor_index] = 1;
                 queue.push(neighbor_index);
                 result.push_back(graph.get_node(neighbor_index));
             }
-        }
+        });
      }
      return result;
 }
@@ -99,4 +99,55 @@ std::vector<std::vector<Node>> bfs_digraph(const IGraph<Node>& graph) {
     return result;
 }
 
+/**
+ * @struct BFSTree
+ * @brief Árvore de uma busca em largura a partir de um nó, indexada pelos índices dos nós.
+ */
+struct BFSTree {
+    std::vector<int> parent; // Pai de cada nó na árvore; -1 para a raiz e para nós não alcançados.
+    std::vector<int> level;  // Distância em arestas até a raiz; -1 para nós não alcançados.
+
+    BFSTree(size_t order = 0) : parent(order, -1), level(order, -1) {}
+
+    /*Indica se o nó de índice 'index' foi alcançado pela busca*/
+    bool reached(int index) const {
+        return level[index] != -1;
+    }
+};
+
+/**
+ * @brief Realiza a BFS a partir de um índice e devolve os pais e os níveis de cada nó.
+ *
+ * É a mesma travessia de bfs_visit, com uma fila em vetor; serve de referência para
+ * direction_optimizing_bfs (DirectionOptimizingBfs.h), que produz os mesmos níveis.
+ * @param graph O grafo no qual a busca será realizada.
+ * @param start_index O índice do nó de partida.
+ * @return A árvore da busca.
+ * @throws std::out_of_range se o índice for inválido.
+ */
+template<typename Node>
+BFSTree bfs_tree(const IGraph<Node>& graph, int start_index) {
+    if (start_index < 0 || static_cast<size_t>(start_index) >= graph.get_order()) {
+        throw std::out_of_range("bfs_tree: Index out of range");
+    }
+
+    BFSTree tree(graph.get_order());
+    std::vector<int> queue;
+    queue.reserve(graph.get_order());
+    tree.level[start_index] = 0;
+    queue.push_back(start_index);
+
+    for (size_t head = 0; head < queue.size(); ++head) {
+        int current = queue[head];
+        graph.for_each_neighbor(current, [&](int neighbor_index) {
+            if (tree.level[neighbor_index] == -1) {
+                tree.level[neighbor_index] = tree.level[current] + 1;
+                tree.parent[neighbor_index] = current;
+                queue.push_back(neighbor_index);
+            }
+        });
+    }
+    return tree;
+}
+
 #endif // BFS_H
\ No newline at end of file
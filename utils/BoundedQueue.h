@@ -0,0 +1,80 @@
+#ifndef BOUNDED_QUEUE_H
+#define BOUNDED_QUEUE_H
+
+#include <deque>
+#include <mutex>
+#include <condition_variable>
+#include <utility>
+#include <cstddef>
+
+/**
+ * @class BoundedQueue
+ * @brief Fila com capacidade limitada para passar dados entre threads.
+ * @tparam T O tipo dos itens da fila.
+ *
+ * push bloqueia enquanto a fila está cheia e pop bloqueia enquanto está vazia, de modo que um
+ * produtor mais rápido que o consumidor não acumula memória sem limite. close acorda todas as
+ * threads: a partir dele push falha, e pop devolve os itens restantes e depois falha.
+ */
+template<typename T>
+class BoundedQueue {
+    std::deque<T> items;
+    size_t capacity;
+    bool closed = false;
+    std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+
+public:
+    explicit BoundedQueue(size_t capacity) : capacity(capacity == 0 ? 1 : capacity) {}
+
+    BoundedQueue(const BoundedQueue&) = delete;
+    BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+    /**
+     * @brief Insere um item, esperando enquanto a fila estiver cheia.
+     * @return false se a fila tiver sido fechada; o item é descartado.
+     */
+    bool push(T item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_full.wait(lock, [this]() { return closed || items.size() < capacity; });
+        if (closed) {
+            return false;
+        }
+        items.push_back(std::move(item));
+        lock.unlock();
+        not_empty.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Remove o item mais antigo, esperando enquanto a fila estiver vazia.
+     * @return false se a fila estiver fechada e sem itens.
+     */
+    bool pop(T& item) {
+        std::unique_lock<std::mutex> lock(mutex);
+        not_empty.wait(lock, [this]() { return closed || !items.empty(); });
+        if (items.empty()) {
+            return false;
+        }
+        item = std::move(items.front());
+        items.pop_front();
+        lock.unlock();
+        not_full.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Fecha a fila e acorda as threads que esperam por ela.
+     */
+    void close() {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            closed = true;
+        }
+        not_full.notify_all();
+        not_empty.notify_all();
+    }
+};
+
+#endif // BOUNDED_QUEUE_H
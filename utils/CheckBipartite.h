@@ -17,27 +17,21 @@
  */
 template<typename Node>
 bool check_bipartite_dfs(const IGraph<Node>& graph, std::vector<int>& discovery, int node) {
-    // Percorre todos os vizinhos do vértice atual
-    for (int neighbor_index : graph.get_neighbors_indices(node)) {
+    // Percorre todos os vizinhos do vértice atual. A iteração é interrompida (retornando falso)
+    // assim que um conflito de cores é encontrado
+    return graph.for_each_neighbor(node, [&](int neighbor_index) {
         // Se o vizinho não foi descoberto ainda
         if (discovery[neighbor_index] == -1) {
             // "Colore" o vizinho com a cor oposta e visita
             discovery[neighbor_index] = 1 - discovery[node];
 
             // Se foi encontrado algum conflito de cores, retorna falso
-            if (!check_bipartite_dfs(graph, discovery, neighbor_index)) {
-                return false;
-            }
-        }
-        // Se o vizinho já foi descoberto e a cor dele é a mesma do vértice atual
-        else if (discovery[node] == discovery[neighbor_index]) {
-            // Retorna falso, indicando que o grafo não é bipartido
-            return false;
+            return check_bipartite_dfs(graph, discovery, neighbor_index);
         }
-    }
 
-    // Se não foi encontrado nenhum conflito, retorna verdareiro
-    return true;
+        // Se o vizinho já foi descoberto, há conflito caso a cor dele seja a mesma do vértice atual
+        return discovery[node] != discovery[neighbor_index];
+    });
 }
 
 /**
@@ -0,0 +1,329 @@
+#ifndef COMPONENTS_H
+#define COMPONENTS_H
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <exception>
+#include <algorithm>
+#include <unordered_map>
+#include <random>
+#include <cstdint>
+
+#include "../graph/IGraph.h"
+
+/**
+ * @struct ComponentLabels
+ * @brief Os componentes conexos de um grafo, como um identificador por nó.
+ *
+ * Os componentes são numerados de 0 a count() - 1 na ordem do menor índice de cada um, a
+ * mesma ordem em que bfs_digraph os encontra em um grafo não-direcionado.
+ */
+struct ComponentLabels {
+    std::vector<int> component; // Identificador do componente de cada nó, indexado pelo índice do nó.
+    std::vector<size_t> sizes;  // Número de nós de cada componente.
+
+    /**
+     * @brief O número de componentes.
+     */
+    size_t count() const {
+        return sizes.size();
+    }
+
+    /**
+     * @brief Agrupa os nós de cada componente, em ordem crescente de índice.
+     * @param graph O grafo do qual os rótulos foram calculados.
+     * @return Um vetor de nós por componente.
+     */
+    template<typename Node>
+    std::vector<std::vector<Node>> groups(const IGraph<Node>& graph) const {
+        std::vector<std::vector<Node>> result(count());
+        for (size_t id = 0; id < count(); id++) {
+            result[id].reserve(sizes[id]);
+        }
+        for (size_t i = 0; i < component.size(); i++) {
+            result[component[i]].push_back(graph.get_node(i));
+        }
+        return result;
+    }
+};
+
+/**
+ * @class ConnectedComponents
+ * @brief Componentes conexos por union-find concorrente, com a amostragem do Afforest
+ * (Sutton, Ben-Nun e Barak).
+ * @tparam Node O tipo de dado dos nós do grafo.
+ *
+ * @details Cada nó guarda um pai em um vetor atômico, sempre com índice menor ou igual ao do
+ * próprio nó, e as threads unem as árvores dos extremos das arestas trocando a raiz de maior
+ * índice pela de menor índice com compare_exchange. A busca é feita em duas etapas:
+ *
+ * 1. Cada nó é unido aos seus NEIGHBOR_ROUNDS primeiros vizinhos, o que já forma quase todo o
+ * componente gigante dos grafos reais.
+ * 2. Um componente frequente é escolhido por amostragem, e só os nós fora dele precisam ter o
+ * restante das arestas examinado.
+ *
+ * Em grafos direcionados são calculados os componentes fracamente conexos. A etapa 2 examina
+ * os vizinhos de entrada dos nós fora do componente escolhido, e por isso só pula o componente
+ * quando o grafo tem has_in_neighbor_access; caso contrário, todas as arestas são examinadas.
+ *
+ * O grafo não pode ser modificado durante a busca, e suas operações const precisam poder ser
+ * chamadas por várias threads ao mesmo tempo.
+ */
+template<typename Node>
+class ConnectedComponents {
+    // Número de vizinhos de cada nó examinados na etapa 1.
+    static constexpr int NEIGHBOR_ROUNDS = 2;
+    // Número de nós sorteados para escolher o componente frequente.
+    static constexpr size_t SAMPLE_SIZE = 1024;
+    // Número de nós retirados de uma vez por cada thread.
+    static constexpr size_t CHUNK_SIZE = 1024;
+
+    const IGraph<Node>& graph;
+    unsigned thread_count;
+    size_t order;
+    std::unique_ptr<std::atomic<int>[]> parent;
+    // Uniões bem-sucedidas: o número de componentes é order - merges.
+    std::atomic<size_t> merges{0};
+    bool stop_when_connected = false;
+
+    /**
+     * @brief Indica se a busca pode parar porque todos os nós já estão no mesmo componente.
+     */
+    bool connected() const {
+        return stop_when_connected && merges.load(std::memory_order_relaxed) + 1 >= order;
+    }
+
+    /**
+     * @brief Chama body(begin, end) para blocos de [0, order), distribuídos entre as threads.
+     */
+    template<class Body>
+    void for_each_chunk(Body&& body) {
+        std::atomic<size_t> cursor{0};
+        auto work = [&]() {
+            for (;;) {
+                if (connected()) {
+                    break;
+                }
+                size_t begin = cursor.fetch_add(CHUNK_SIZE, std::memory_order_relaxed);
+                if (begin >= order) {
+                    break;
+                }
+                body(begin, std::min(begin + CHUNK_SIZE, order));
+            }
+        };
+
+        unsigned workers_count = static_cast<unsigned>(
+            std::min<size_t>(thread_count, (order + CHUNK_SIZE - 1) / CHUNK_SIZE));
+        if (workers_count <= 1) {
+            work();
+            return;
+        }
+
+        std::vector<std::exception_ptr> errors(workers_count);
+        std::vector<std::thread> workers;
+        workers.reserve(workers_count - 1);
+        for (unsigned t = 1; t < workers_count; ++t) {
+            workers.emplace_back([&, t]() {
+                try {
+                    work();
+                } catch (...) {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+        try {
+            work();
+        } catch (...) {
+            errors[0] = std::current_exception();
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+    }
+
+    /**
+     * @brief Une as árvores dos nós u e v.
+     */
+    void link(int u, int v) {
+        int p1 = parent[u].load(std::memory_order_relaxed);
+        int p2 = parent[v].load(std::memory_order_relaxed);
+        while (p1 != p2) {
+            int high = std::max(p1, p2);
+            int low = std::min(p1, p2);
+            int p_high = parent[high].load(std::memory_order_relaxed);
+            /*As árvores já foram unidas por outra thread*/
+            if (p_high == low) {
+                break;
+            }
+            /*Se 'high' ainda é raiz, passa a apontar para 'low', que não está na sua árvore*/
+            if (p_high == high && parent[high].compare_exchange_strong(p_high, low)) {
+                merges.fetch_add(1, std::memory_order_relaxed);
+                break;
+            }
+            p1 = parent[parent[high].load(std::memory_order_relaxed)].load(std::memory_order_relaxed);
+            p2 = parent[low].load(std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Faz cada nó apontar diretamente para a raiz da sua árvore.
+     */
+    void compress() {
+        for_each_chunk([&](size_t begin, size_t end) {
+            for (size_t i = begin; i < end; ++i) {
+                for (;;) {
+                    int p = parent[i].load(std::memory_order_relaxed);
+                    int grandparent = parent[p].load(std::memory_order_relaxed);
+                    if (p == grandparent) {
+                        break;
+                    }
+                    parent[i].store(grandparent, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    /**
+     * @brief Sorteia nós e devolve a raiz mais frequente entre eles.
+     */
+    int sample_frequent_root() const {
+        std::mt19937 rng(27491095);
+        std::uniform_int_distribution<size_t> pick(0, order - 1);
+        std::unordered_map<int, size_t> counts;
+        for (size_t k = 0; k < SAMPLE_SIZE; ++k) {
+            counts[parent[pick(rng)].load(std::memory_order_relaxed)]++;
+        }
+        return std::max_element(counts.begin(), counts.end(),
+                                [](const auto& a, const auto& b) { return a.second < b.second; })->first;
+    }
+
+    /**
+     * @brief Une as árvores dos extremos de todas as arestas.
+     */
+    void run() {
+        for (size_t i = 0; i < order; ++i) {
+            parent[i].store(static_cast<int>(i), std::memory_order_relaxed);
+        }
+        merges.store(0, std::memory_order_relaxed);
+        if (order == 0) {
+            return;
+        }
+
+        /*Etapa 1: o r-ésimo vizinho de cada nó, um por rodada*/
+        for (int round = 0; round < NEIGHBOR_ROUNDS && !connected(); ++round) {
+            for_each_chunk([&](size_t begin, size_t end) {
+                for (size_t u = begin; u < end; ++u) {
+                    int position = 0;
+                    graph.for_each_neighbor(u, [&](int v) {
+                        if (position++ < round) {
+                            return true;
+                        }
+                        link(u, v);
+                        return false;
+                    });
+                }
+            });
+            compress();
+        }
+        if (connected()) {
+            return;
+        }
+
+        /*Etapa 2: as demais arestas, pulando os nós do componente frequente quando possível*/
+        bool check_in_arcs = graph.is_directed();
+        int skipped = -1;
+        if (!check_in_arcs || graph.has_in_neighbor_access()) {
+            skipped = sample_frequent_root();
+        }
+        for_each_chunk([&](size_t begin, size_t end) {
+            for (size_t u = begin; u < end; ++u) {
+                if (parent[u].load(std::memory_order_relaxed) == skipped) {
+                    continue;
+                }
+                int position = 0;
+                graph.for_each_neighbor(u, [&](int v) {
+                    if (position++ >= NEIGHBOR_ROUNDS) {
+                        link(u, v);
+                    }
+                });
+                if (check_in_arcs && skipped != -1) {
+                    graph.for_each_in_neighbor(u, [&](int v) {
+                        link(u, v);
+                    });
+                }
+            }
+        });
+        compress();
+    }
+
+public:
+    /**
+     * @brief Prepara a busca de componentes em um grafo.
+     * @param graph O grafo a ser analisado.
+     * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+     */
+    explicit ConnectedComponents(const IGraph<Node>& graph, unsigned num_threads = 0)
+        : graph(graph),
+          thread_count(num_threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : num_threads),
+          order(graph.get_order()),
+          parent(new std::atomic<int>[graph.get_order()]) {}
+
+    /**
+     * @brief Calcula o componente de cada nó e o tamanho de cada componente.
+     */
+    ComponentLabels labels() {
+        stop_when_connected = false;
+        run();
+
+        /*A raiz de cada árvore é o menor índice do componente, e os demais nós apontam para ela*/
+        ComponentLabels result;
+        result.component.resize(order);
+        for (size_t i = 0; i < order; ++i) {
+            int root = parent[i].load(std::memory_order_relaxed);
+            if (root == static_cast<int>(i)) {
+                result.component[i] = static_cast<int>(result.sizes.size());
+                result.sizes.push_back(0);
+            } else {
+                result.component[i] = result.component[root];
+            }
+            result.sizes[result.component[i]]++;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Verifica se o grafo tem um único componente, parando assim que isso for garantido.
+     */
+    bool is_connected() {
+        if (order <= 1) {
+            return true;
+        }
+        /*Um grafo conexo com n nós tem pelo menos n - 1 arestas*/
+        if (graph.get_size() + 1 < order) {
+            return false;
+        }
+        stop_when_connected = true;
+        run();
+        return merges.load(std::memory_order_relaxed) + 1 == order;
+    }
+};
+
+/**
+ * @brief Calcula os componentes conexos de um grafo (fracamente conexos, se for direcionado).
+ * @param graph O grafo a ser analisado.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return O identificador do componente de cada nó e o tamanho de cada componente.
+ */
+template<typename Node>
+ComponentLabels connected_components(const IGraph<Node>& graph, unsigned num_threads = 0) {
+    return ConnectedComponents<Node>(graph, num_threads).labels();
+}
+
+#endif // COMPONENTS_H
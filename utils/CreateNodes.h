@@ -0,0 +1,93 @@
+#ifndef CREATE_NODES_H
+#define CREATE_NODES_H
+
+#include <string>
+#include <iostream>
+#include <type_traits>
+
+#include "../graph/IGraph.h"
+#include "../graph/GraphBuilder.h"
+
+/*
+ * Numeração dos nós declarados no cabeçalho dos arquivos de arestas, compartilhada pelos
+ * leitores de GraphIO.h, EdgeListParser.h, GraphFormats.h e PipelinedLoader.h.
+ */
+
+/**
+ * @brief Adiciona ao grafo os nós numerados pelo cabeçalho dos arquivos de arestas.
+ *
+ * Nós char recebem 'A', 'B', ...; nós int, 1, 2, ..., n; e nós std::string, os rótulos
+ * "1", "2", ..., "n".
+ * @param graph O grafo onde os nós serão inseridos.
+ * @param num_nodes O número de nós do cabeçalho.
+ */
+template<typename Node>
+void create_nodes(IGraph<Node>& graph, const int num_nodes) {
+    using U = std::remove_cv_t<Node>; // remove const/volatile e referências
+    if constexpr (std::is_same_v<U, char>) {
+        char start_char = 'A';
+        for (int i = 0; i < num_nodes; ++i) {
+            graph.add_node(static_cast<Node>(start_char + i));
+        }
+    } else if constexpr (std::is_same_v<U, int>) {
+        int start_int = 1;
+        for (int i = 0; i < num_nodes; ++i) {
+            graph.add_node(static_cast<Node>(start_int + i));
+        }
+    } else if constexpr (std::is_same_v<U, std::string>) {
+        // Rótulos "1", "2", ..., como os nós int
+        for (int i = 0; i < num_nodes; ++i) {
+            graph.add_node(std::to_string(1 + i));
+        }
+    } else {
+        std::cout << "Node é outro tipo\n";
+        return;
+    }
+}
+
+/*Registra em um GraphBuilder os mesmos nós que create_nodes criaria em um grafo*/
+template<typename Node, typename NodeMap>
+void create_nodes(GraphBuilder<Node, NodeMap>& builder, const int num_nodes) {
+    using U = std::remove_cv_t<Node>;
+    if constexpr (std::is_same_v<U, char>) {
+        for (int i = 0; i < num_nodes; ++i) {
+            builder.add_node(static_cast<Node>('A' + i));
+        }
+    } else if constexpr (std::is_same_v<U, int>) {
+        for (int i = 0; i < num_nodes; ++i) {
+            builder.add_node(static_cast<Node>(1 + i));
+        }
+    } else if constexpr (std::is_same_v<U, std::string>) {
+        for (int i = 0; i < num_nodes; ++i) {
+            builder.add_node(std::to_string(1 + i));
+        }
+    } else {
+        std::cout << "Node é outro tipo\n";
+    }
+}
+
+/**
+ * @brief Indica se create_nodes numera os nós do tipo com valores consecutivos ('A'.. ou 1..),
+ * de modo que created_node_index converte um nó no seu índice sem consultar o grafo.
+ */
+template<typename Node>
+constexpr bool has_created_node_index =
+    std::is_same_v<std::remove_cv_t<Node>, char> || std::is_same_v<std::remove_cv_t<Node>, int>;
+
+/**
+ * @brief Retorna o índice que create_nodes atribui ao nó.
+ * @return O índice, ou -1 se o nó não estiver entre os num_nodes nós criados.
+ */
+template<typename Node>
+int created_node_index(const Node& node, const int num_nodes) {
+    static_assert(has_created_node_index<Node>, "created_node_index: nodes must be char or int");
+    long long index;
+    if constexpr (std::is_same_v<std::remove_cv_t<Node>, char>) {
+        index = static_cast<long long>(node) - 'A';
+    } else {
+        index = static_cast<long long>(node) - 1;
+    }
+    return index >= 0 && index < num_nodes ? static_cast<int>(index) : -1;
+}
+
+#endif // CREATE_NODES_H
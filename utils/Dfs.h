@@ -9,6 +9,7 @@
 #include <iostream>
 #include <numeric>
 #include <unordered_map>
+#include <array>
 
 #include "../graph/IGraph.h"
 
@@ -64,84 +65,300 @@ struct DFSResult {
     std::unordered_map<EdgeType, std::vector<Edge<Node>>> edges;
 };
 
+/**
+ * @struct DFSIndexResult
+ * @brief Resultado da busca DFS em função dos índices dos nós, sem mapas por nó.
+ *
+ * @details Os tempos e os pais ficam em vetores indexados pelos índices dos nós, e as arestas
+ * classificadas, se pedidas, como pares de índices. A conversão para Node só acontece quando
+ * um dos métodos que recebem ou devolvem nós é chamado, o que exige que o grafo da busca
+ * continue existindo e não seja modificado.
+ */
+template<typename Node>
+struct DFSIndexResult {
+    const IGraph<Node>* graph = nullptr;
+    std::vector<int> discovery, exit; // 0 para nós não alcançados.
+    std::vector<int> parent;          // -1 para as raízes e para nós não alcançados.
+    std::array<std::vector<EdgeIndex>, 4> edges; // Indexado por EdgeType; vazio sem classificação.
+
+    /**
+     * @brief Indica se o nó de índice 'index' foi alcançado pela busca.
+     */
+    bool reached(int index) const {
+        return discovery[index] != 0;
+    }
+
+    /**
+     * @brief As arestas de um tipo, como pares de índices.
+     */
+    const std::vector<EdgeIndex>& edges_of(EdgeType type) const {
+        return edges[static_cast<size_t>(type)];
+    }
+
+    /**
+     * @brief O tempo de descoberta de um nó, ou 0 se ele não foi alcançado.
+     * @throws std::invalid_argument se o nó não existir no grafo.
+     */
+    int discovery_of(const Node& node) const {
+        return discovery[index_of(node)];
+    }
+
+    /**
+     * @brief O tempo de saída de um nó, ou 0 se ele não foi alcançado.
+     * @throws std::invalid_argument se o nó não existir no grafo.
+     */
+    int exit_of(const Node& node) const {
+        return exit[index_of(node)];
+    }
+
+    /**
+     * @brief O pai de um nó na floresta da busca, se ele tiver um.
+     * @throws std::invalid_argument se o nó não existir no grafo.
+     */
+    std::optional<Node> parent_of(const Node& node) const {
+        int parent_index = parent[index_of(node)];
+        if (parent_index == -1) {
+            return std::nullopt;
+        }
+        return graph->get_node(parent_index);
+    }
+
+    /**
+     * @brief Converte as arestas de um tipo para pares de nós.
+     */
+    std::vector<Edge<Node>> node_edges_of(EdgeType type) const {
+        std::vector<Edge<Node>> result;
+        result.reserve(edges_of(type).size());
+        for (const EdgeIndex& edge : edges_of(type)) {
+            result.push_back({graph->get_node(edge.from), graph->get_node(edge.to)});
+        }
+        return result;
+    }
+
+    /**
+     * @brief Converte todo o resultado para um DFSResult, com mapas indexados pelos nós.
+     */
+    DFSResult<Node> to_result() const {
+        DFSResult<Node> result;
+        for (size_t i = 0; i < discovery.size(); i++) {
+            Node node = graph->get_node(i);
+            result.discovery[node] = discovery[i];
+            result.exit[node] = exit[i];
+        }
+        /*Como em dfs, só aparecem no mapa os tipos de aresta encontrados*/
+        for (EdgeType type : {EdgeType::TREE, EdgeType::BACK, EdgeType::FORWARD, EdgeType::CROSS}) {
+            if (!edges_of(type).empty()) {
+                result.edges[type] = node_edges_of(type);
+            }
+        }
+        return result;
+    }
+
+private:
+    int index_of(const Node& node) const {
+        int index = graph->get_index(node);
+        if (index < 0) {
+            throw std::invalid_argument("Node does not exist in the graph.");
+        }
+        return index;
+    }
+};
+
 
 /**
- * @brief Função recursiva principal que executa a visita DFS a partir de um nó.
+ * @struct DFSStack
+ * @brief Pilha explícita usada por dfs_visit no lugar da pilha de chamadas.
  *
- * @param node O índice do nó atual a ser visitado.
+ * @details Cada quadro guarda um nó e um cursor sobre os seus vizinhos. Os vizinhos de todos os
+ * nós da pilha ficam em sequência no vetor 'neighbors': os de um nó são copiados para o final
+ * dele quando o nó é descoberto e descartados quando ele sai, então o vetor também se comporta
+ * como uma pilha. Reaproveitar o mesmo DFSStack em várias chamadas evita realocar os vetores.
+ */
+struct DFSStack {
+    struct Frame {
+        int node;
+        size_t cursor; // Posição em 'neighbors' do próximo vizinho a examinar.
+        size_t end;    // Fim dos vizinhos do nó em 'neighbors'.
+    };
+
+    std::vector<Frame> frames;
+    std::vector<int> neighbors;
+};
+
+/**
+ * @brief Executa a visita DFS a partir de um nó, usando uma pilha explícita.
+ *
+ * @details A ordem de visita, os tempos e a classificação das arestas são os de uma DFS
+ * recursiva, mas a profundidade da busca não é limitada pelo tamanho da pilha de chamadas.
+ * @param node O índice do nó inicial da visita.
  * @param time O contador de tempo global passado por referência.
  * @param discovery, exit, parent Vetores para manter o tempo de descoberta, tempo de saída e pais dos nós.
  * @param find_tree, find_back, find_forward, find_cross Funções a serem chamadas ao encontrar cada tipo de aresta.
+ * @param stack A pilha da busca, vazia no início e no fim da chamada.
  */
 template<typename Node, class FindTree, class FindBack, class FindForward, class FindCross>
 void dfs_visit(const IGraph<Node>& graph,
             int node, int& time,
             std::vector<int>& discovery, std::vector<int>& exit,
             std::vector<int>& parent,
-            FindTree find_tree, FindBack find_back,
-            FindForward find_forward, FindCross find_cross) {
+            FindTree& find_tree, FindBack& find_back,
+            FindForward& find_forward, FindCross& find_cross,
+            DFSStack& stack) {
+
+    /*Marca o tempo de descoberta de um nó e empilha um quadro com os seus vizinhos*/
+    auto enter = [&](int index) {
+        discovery[index] = ++time;
+        size_t begin = stack.neighbors.size();
+        graph.for_each_neighbor(index, [&](int neighbor_index) {
+            stack.neighbors.push_back(neighbor_index);
+        });
+        stack.frames.push_back({index, begin, stack.neighbors.size()});
+    };
+
+    enter(node);
+    while (!stack.frames.empty()) {
+        DFSStack::Frame& frame = stack.frames.back();
+
+        /*Todos os vizinhos do nó do topo foram visitados, então marca o tempo de saída*/
+        if (frame.cursor == frame.end) {
+            exit[frame.node] = ++time;
+            stack.frames.pop_back();
+            /*Os vizinhos do nó começavam onde terminam os do quadro de baixo*/
+            stack.neighbors.resize(stack.frames.empty() ? 0 : stack.frames.back().end);
+            continue;
+        }
 
-    /* Marca o tempo de descoberta do nó atual */
-    discovery[node] = ++time;
+        int current = frame.node;
+        int neighbor_index = stack.neighbors[frame.cursor++];
 
-    /*Explora todos os vizinhos do nó atual*/
-    for(int neighbor_index : graph.get_neighbors_indices(node)) {
         /*Se o vizinho ainda não foi descoberto, é uma aresta de árvore*/
         if (discovery[neighbor_index] == 0) {
-            parent[neighbor_index] = node;
-            find_tree(node, neighbor_index);
-            dfs_visit(graph, neighbor_index, time, discovery, exit, parent,
-                      find_tree, find_back, find_forward, find_cross);
+            parent[neighbor_index] = current;
+            find_tree(current, neighbor_index);
+            enter(neighbor_index); // Invalida 'frame'.
         } else if (exit[neighbor_index] == 0) {
             /*Se o vizinho foi descoberto mas não saiu, é uma aresta de retorno*/
-            find_back(node, neighbor_index);
-        } else if (discovery[node] < discovery[neighbor_index]) {
+            find_back(current, neighbor_index);
+        } else if (discovery[current] < discovery[neighbor_index]) {
             /*Se o vizinho já saiu e foi descoberto depois do nó atual, é uma aresta de avanço*/
-            find_forward(node, neighbor_index);
+            find_forward(current, neighbor_index);
         } else {
             /*Se o vizinho já saiu e foi descoberto antes do nó atual, é uma aresta de cruzamento*/
-            find_cross(node, neighbor_index);
+            find_cross(current, neighbor_index);
         }
     }
+}
 
-    /*Todos os vizinhos do nó atual foram visitados, então marca o tempo de saída*/
-    exit[node] = ++time;
+/**
+ * @brief Executa a visita DFS a partir de um nó com uma pilha própria.
+ *
+ * @param node O índice do nó atual a ser visitado.
+ * @param time O contador de tempo global passado por referência.
+ * @param discovery, exit, parent Vetores para manter o tempo de descoberta, tempo de saída e pais dos nós.
+ * @param find_tree, find_back, find_forward, find_cross Funções a serem chamadas ao encontrar cada tipo de aresta.
+ */
+template<typename Node, class FindTree, class FindBack, class FindForward, class FindCross>
+void dfs_visit(const IGraph<Node>& graph,
+            int node, int& time,
+            std::vector<int>& discovery, std::vector<int>& exit,
+            std::vector<int>& parent,
+            FindTree find_tree, FindBack find_back,
+            FindForward find_forward, FindCross find_cross) {
+    DFSStack stack;
+    dfs_visit(graph, node, time, discovery, exit, parent,
+              find_tree, find_back, find_forward, find_cross, stack);
 }
 
 /**
- * @brief Função que inicia a busca DFS em todo o grafo, método usado para grafos direcionados,
- * pois nesse caso existem as arestas de cruzamento e avanço.
- * @return Um DFSResult com os tempos e as arestas classificadas de toda a busca.
+ * @brief Executa a DFS a partir das raízes first, first + 1, ..., last - 1 ainda não visitadas.
+ * @param result O resultado a ser preenchido, com os vetores já dimensionados.
+ * @param classify_edges Se false, as arestas não são classificadas nem guardadas.
  */
 template<typename Node>
-DFSResult<Node> dfs(const IGraph<Node>& graph) {
-    DFSState<Node> state(graph.get_order());
+void dfs_indices_visit(const IGraph<Node>& graph, DFSIndexResult<Node>& result,
+                       size_t first, size_t last, bool classify_edges) {
     int time = 0;
+    DFSStack stack;
 
-    /* Funções para classificar as arestas encontradas durante a busca */
-    auto find_tree =[&](int from, int to) {
-        state.edges[EdgeType::TREE].push_back({graph.get_node(from), graph.get_node(to)});
-    };
-    auto find_back = [&](int from, int to) {
-        state.edges[EdgeType::BACK].push_back({graph.get_node(from), graph.get_node(to)});
-    };
-    auto find_forward = [&](int from, int to) {
-        state.edges[EdgeType::FORWARD].push_back({graph.get_node(from), graph.get_node(to)});
-    };
-    auto find_cross = [&](int from, int to) {
-        state.edges[EdgeType::CROSS].push_back({graph.get_node(from), graph.get_node(to)});
-    };
+    if (classify_edges) {
+        auto find = [&result](EdgeType type) {
+            return [&result, type](int from, int to) {
+                result.edges[static_cast<size_t>(type)].push_back({from, to});
+            };
+        };
+        auto find_tree = find(EdgeType::TREE);
+        auto find_back = find(EdgeType::BACK);
+        auto find_forward = find(EdgeType::FORWARD);
+        auto find_cross = find(EdgeType::CROSS);
 
+        for (size_t i = first; i < last; i++) {
+            if (result.discovery[i] == 0) {
+                dfs_visit(graph, i, time, result.discovery, result.exit, result.parent,
+                          find_tree, find_back, find_forward, find_cross, stack);
+            }
+        }
+    } else {
+        auto empty = [](int, int) {};
 
-    /*Inicia a DFS para cada nó não visitado, garantindo que todos os componentes sejam explorados*/
-    for(size_t i = 0; i < graph.get_order(); i++) {
-        if (state.discovery[i] == 0) {
-            dfs_visit(graph, i, time, state.discovery, state.exit, state.parent,
-                      find_tree, find_back, find_forward, find_cross);
+        for (size_t i = first; i < last; i++) {
+            if (result.discovery[i] == 0) {
+                dfs_visit(graph, i, time, result.discovery, result.exit, result.parent,
+                          empty, empty, empty, empty, stack);
+            }
         }
     }
+}
 
-    return get_result_dfs(graph, state);
+/**
+ * @brief Executa a DFS em todo o grafo e devolve o resultado em função dos índices dos nós.
+ *
+ * Os tempos, os pais e a classificação das arestas são os mesmos de dfs.
+ * @param classify_edges Se true, as arestas são classificadas e guardadas como pares de índices.
+ * @return Um DFSIndexResult que referencia o grafo.
+ */
+template<typename Node>
+DFSIndexResult<Node> dfs_indices(const IGraph<Node>& graph, bool classify_edges = false) {
+    DFSIndexResult<Node> result;
+    result.graph = &graph;
+    result.discovery.assign(graph.get_order(), 0);
+    result.exit.assign(graph.get_order(), 0);
+    result.parent.assign(graph.get_order(), -1);
+
+    dfs_indices_visit(graph, result, 0, graph.get_order(), classify_edges);
+    return result;
+}
+
+/**
+ * @brief Executa a DFS apenas a partir de um nó, por exemplo para saber quais nós ele alcança.
+ * @param start_index O índice do nó inicial da busca.
+ * @param classify_edges Se true, as arestas são classificadas e guardadas como pares de índices.
+ * @return Um DFSIndexResult que referencia o grafo; os nós não alcançados têm tempos 0.
+ * @throws std::out_of_range se o índice for inválido.
+ */
+template<typename Node>
+DFSIndexResult<Node> dfs_indices_from(const IGraph<Node>& graph, int start_index, bool classify_edges = false) {
+    if (start_index < 0 || static_cast<size_t>(start_index) >= graph.get_order()) {
+        throw std::out_of_range("dfs_indices_from: Index out of range");
+    }
+
+    DFSIndexResult<Node> result;
+    result.graph = &graph;
+    result.discovery.assign(graph.get_order(), 0);
+    result.exit.assign(graph.get_order(), 0);
+    result.parent.assign(graph.get_order(), -1);
+
+    dfs_indices_visit(graph, result, start_index, start_index + 1, classify_edges);
+    return result;
+}
+
+/**
+ * @brief Função que inicia a busca DFS em todo o grafo, método usado para grafos direcionados,
+ * pois nesse caso existem as arestas de cruzamento e avanço.
+ * @return Um DFSResult com os tempos e as arestas classificadas de toda a busca.
+ */
+template<typename Node>
+DFSResult<Node> dfs(const IGraph<Node>& graph) {
+    return dfs_indices(graph, true).to_result();
 }
 
 /**
@@ -0,0 +1,227 @@
+#ifndef DIRECTION_OPTIMIZING_BFS_H
+#define DIRECTION_OPTIMIZING_BFS_H
+
+#include <vector>
+#include <stdexcept>
+#include <utility>
+#include <cstdint>
+
+#include "../graph/IGraph.h"
+#include "Bfs.h"
+
+/**
+ * @class DirectionOptimizingBfs
+ * @brief BFS que alterna entre as etapas top-down e bottom-up conforme o tamanho da fronteira
+ * (Beamer, Asanović e Patterson).
+ * @tparam Node O tipo de dado dos nós do grafo.
+ *
+ * @details A etapa top-down percorre os vizinhos de cada nó da fronteira, como bfs_visit. A
+ * etapa bottom-up faz o contrário: cada nó ainda não alcançado procura, entre os seus vizinhos
+ * de entrada, algum que esteja na fronteira, e para no primeiro que encontrar. Em grafos de
+ * diâmetro pequeno com graus muito desiguais, as duas ou três fronteiras do meio contêm quase
+ * todos os nós, e a etapa bottom-up deixa de examinar a maior parte das suas arestas.
+ *
+ * A troca segue as heurísticas do artigo: passa para bottom-up quando as arestas a examinar a
+ * partir da fronteira (m_f) superam as arestas dos nós não alcançados (m_u) divididas por alpha,
+ * e volta para top-down quando a fronteira diminui e tem menos de n / beta nós.
+ *
+ * A etapa bottom-up precisa dos vizinhos de entrada. Se o grafo não os oferece com o mesmo
+ * custo dos vizinhos de saída (veja IGraph::has_in_neighbor_access), os arcos de entrada são
+ * montados uma única vez no construtor, em formato CSR. O construtor também calcula os graus
+ * dos nós, então o mesmo objeto deve ser reaproveitado para várias buscas no mesmo grafo, que
+ * não pode ser modificado enquanto ele existir.
+ *
+ * Os níveis são os mesmos de bfs_tree; os pais formam uma árvore de BFS válida, mas, quando
+ * um nó tem mais de um predecessor no nível anterior, podem ser outros.
+ */
+template<typename Node>
+class DirectionOptimizingBfs {
+    const IGraph<Node>& graph;
+    int alpha;
+    int beta;
+
+    // Grau de saída e de entrada de cada nó.
+    std::vector<int64_t> out_degree;
+    std::vector<int64_t> in_degree;
+    int64_t arc_count = 0;
+
+    // Arcos de entrada em CSR, usados quando o grafo não tem has_in_neighbor_access.
+    bool own_in_arcs = false;
+    std::vector<size_t> in_offsets;
+    std::vector<int> in_sources;
+
+    /**
+     * @brief Visita os vizinhos de entrada de um nó até que visit retorne false.
+     */
+    template<typename Visit>
+    void visit_in_neighbors(int index, Visit&& visit) const {
+        if (own_in_arcs) {
+            for (size_t k = in_offsets[index]; k < in_offsets[index + 1]; ++k) {
+                if (!visit(in_sources[k])) {
+                    return;
+                }
+            }
+        } else {
+            graph.for_each_in_neighbor(index, [&visit](int source_index) {
+                return visit(source_index);
+            });
+        }
+    }
+
+    /**
+     * @brief Expande a fronteira pelos vizinhos de saída de cada nó.
+     * @return A soma dos graus de saída dos nós alcançados (m_f da próxima fronteira).
+     */
+    int64_t top_down_step(BFSTree& tree, const std::vector<int>& frontier, std::vector<int>& next,
+                          int64_t& unexplored_arcs) const {
+        int64_t scout_count = 0;
+        for (int current : frontier) {
+            graph.for_each_neighbor(current, [&](int neighbor_index) {
+                if (tree.level[neighbor_index] == -1) {
+                    tree.level[neighbor_index] = tree.level[current] + 1;
+                    tree.parent[neighbor_index] = current;
+                    next.push_back(neighbor_index);
+                    scout_count += out_degree[neighbor_index];
+                    unexplored_arcs -= in_degree[neighbor_index];
+                }
+            });
+        }
+        return scout_count;
+    }
+
+    /**
+     * @brief Cada nó não alcançado procura um vizinho de entrada na fronteira.
+     * @return O número de nós alcançados nesta etapa.
+     */
+    size_t bottom_up_step(BFSTree& tree, const std::vector<char>& in_frontier, std::vector<char>& in_next,
+                          int level, int64_t& unexplored_arcs) const {
+        size_t awake_count = 0;
+        int order = static_cast<int>(tree.level.size());
+        for (int index = 0; index < order; ++index) {
+            if (tree.level[index] != -1) {
+                continue;
+            }
+            visit_in_neighbors(index, [&](int source_index) {
+                if (!in_frontier[source_index]) {
+                    return true;
+                }
+                tree.level[index] = level;
+                tree.parent[index] = source_index;
+                in_next[index] = 1;
+                awake_count++;
+                unexplored_arcs -= in_degree[index];
+                return false;
+            });
+        }
+        return awake_count;
+    }
+
+public:
+    /**
+     * @brief Prepara as buscas em um grafo, calculando os graus e, se necessário, os arcos de entrada.
+     * @param graph O grafo no qual as buscas serão realizadas.
+     * @param alpha Divisor de m_u na troca de top-down para bottom-up (15 no artigo).
+     * @param beta Divisor de n na troca de bottom-up para top-down (18 no artigo).
+     */
+    explicit DirectionOptimizingBfs(const IGraph<Node>& graph, int alpha = 15, int beta = 18)
+        : graph(graph), alpha(alpha), beta(beta) {
+        size_t order = graph.get_order();
+        out_degree.assign(order, 0);
+        in_degree.assign(order, 0);
+        for (size_t i = 0; i < order; ++i) {
+            graph.for_each_neighbor(i, [&](int neighbor_index) {
+                out_degree[i]++;
+                in_degree[neighbor_index]++;
+            });
+            arc_count += out_degree[i];
+        }
+
+        own_in_arcs = !graph.has_in_neighbor_access();
+        if (own_in_arcs) {
+            in_offsets.assign(order + 1, 0);
+            for (size_t i = 0; i < order; ++i) {
+                in_offsets[i + 1] = in_offsets[i] + static_cast<size_t>(in_degree[i]);
+            }
+            std::vector<size_t> next_slot(in_offsets.begin(), in_offsets.end() - 1);
+            in_sources.resize(static_cast<size_t>(arc_count));
+            for (size_t i = 0; i < order; ++i) {
+                graph.for_each_neighbor(i, [&](int neighbor_index) {
+                    in_sources[next_slot[neighbor_index]++] = static_cast<int>(i);
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief Realiza a busca a partir de um índice.
+     * @param start_index O índice do nó de partida.
+     * @return A árvore da busca, com os mesmos níveis de bfs_tree.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    BFSTree run(int start_index) const {
+        size_t order = graph.get_order();
+        if (start_index < 0 || static_cast<size_t>(start_index) >= order) {
+            throw std::out_of_range("direction_optimizing_bfs: Index out of range");
+        }
+
+        BFSTree tree(order);
+        tree.level[start_index] = 0;
+        std::vector<int> frontier{start_index};
+        std::vector<int> next;
+        int64_t scout_count = out_degree[start_index];
+        int64_t unexplored_arcs = arc_count - in_degree[start_index];
+
+        while (!frontier.empty()) {
+            if (scout_count > unexplored_arcs / alpha) {
+                /*Fronteira grande: etapas bottom-up enquanto ela crescer ou continuar grande*/
+                std::vector<char> in_frontier(order, 0);
+                std::vector<char> in_next(order, 0);
+                for (int index : frontier) {
+                    in_frontier[index] = 1;
+                }
+                int level = tree.level[frontier.front()];
+                size_t awake_count = frontier.size();
+                size_t old_awake_count;
+                do {
+                    old_awake_count = awake_count;
+                    awake_count = bottom_up_step(tree, in_frontier, in_next, ++level, unexplored_arcs);
+                    in_frontier.swap(in_next);
+                    std::fill(in_next.begin(), in_next.end(), 0);
+                } while (awake_count > 0
+                         && (awake_count >= old_awake_count || awake_count > order / static_cast<size_t>(beta)));
+
+                /*Volta para top-down com a última fronteira*/
+                frontier.clear();
+                scout_count = 0;
+                for (size_t index = 0; index < order; ++index) {
+                    if (in_frontier[index]) {
+                        frontier.push_back(static_cast<int>(index));
+                        scout_count += out_degree[index];
+                    }
+                }
+            } else {
+                next.clear();
+                scout_count = top_down_step(tree, frontier, next, unexplored_arcs);
+                frontier.swap(next);
+            }
+        }
+        return tree;
+    }
+};
+
+/**
+ * @brief Realiza uma BFS com otimização de direção a partir de um nó.
+ *
+ * Para várias buscas no mesmo grafo, crie um DirectionOptimizingBfs e chame run para cada
+ * origem, aproveitando os graus e os arcos de entrada calculados uma única vez.
+ * @param graph O grafo no qual a busca será realizada.
+ * @param start O nó de partida.
+ * @return A árvore da busca, indexada pelos índices dos nós.
+ * @throws std::out_of_range se o nó não existir no grafo.
+ */
+template<typename Node>
+BFSTree direction_optimizing_bfs(const IGraph<Node>& graph, const Node& start) {
+    return DirectionOptimizingBfs<Node>(graph).run(graph.get_index(start));
+}
+
+#endif // DIRECTION_OPTIMIZING_BFS_H
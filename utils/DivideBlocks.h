@@ -61,7 +61,7 @@ std::list<int> divide_blocks_visit(const IGraph<Node>& graph, DivideBlocksState&
     std::list<int> block;
 
     // Para todos os vizinhos do vértice atual
-    for (int neighbor_index : graph.get_neighbors_indices(node)) {
+    graph.for_each_neighbor(node, [&](int neighbor_index) {
         // Se o vizinho ainda não foi descoberto
         if (state.discovery[neighbor_index] == 0) {
             // Ele é filho do vértice atual, logo incrementa o número de filhos
@@ -103,7 +103,7 @@ std::list<int> divide_blocks_visit(const IGraph<Node>& graph, DivideBlocksState&
                 self_lowpt = neighbor_index;
             }
         }
-    }
+    });
 
     // Atualizo o vetor de lowpt
     state.lowpt[node] = self_lowpt;
@@ -0,0 +1,542 @@
+#ifndef EDGE_LIST_PARSER_H
+#define EDGE_LIST_PARSER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <thread>
+#include <exception>
+#include <stdexcept>
+#include <charconv>
+#include <algorithm>
+#include <type_traits>
+#include <limits>
+#include <cmath>
+#include <fstream>
+#include <cstring>
+
+#include "CreateNodes.h"
+#include "MappedFile.h"
+#include "../graph/GraphBuilder.h"
+#include "../graph/StringPool.h"
+
+/**
+ * @brief Remove espaços e '\r' das extremidades de um campo.
+ */
+inline std::string_view trim_field(std::string_view field) {
+    auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+    while (!field.empty() && is_space(field.front())) field.remove_prefix(1);
+    while (!field.empty() && is_space(field.back())) field.remove_suffix(1);
+    return field;
+}
+
+/**
+ * @brief Converte um campo de texto em um nó, sem alocar memória para tipos numéricos.
+ *
+ * char usa o primeiro caractere do campo, tipos numéricos usam std::from_chars e
+ * std::string copia o campo. std::string_view aponta para o próprio texto do arquivo, que
+ * precisa continuar mapeado enquanto o campo for usado.
+ * @return false se o campo não representar um nó válido.
+ */
+template<typename Node>
+bool parse_node_field(std::string_view field, Node& node) {
+    field = trim_field(field);
+    if (field.empty()) {
+        return false;
+    }
+    if constexpr (std::is_same_v<Node, char>) {
+        node = field.front();
+        return true;
+    } else if constexpr (std::is_arithmetic_v<Node> && !std::is_same_v<Node, bool>) {
+        auto result = std::from_chars(field.data(), field.data() + field.size(), node);
+        return result.ec == std::errc();
+    } else if constexpr (std::is_same_v<Node, std::string>) {
+        node.assign(field.data(), field.size());
+        return true;
+    } else if constexpr (std::is_same_v<Node, std::string_view>) {
+        node = field;
+        return true;
+    } else {
+        static_assert(sizeof(Node) == 0, "parse_node_field: unsupported node type");
+        return false;
+    }
+}
+
+/**
+ * @struct ParsedEdgeChunk
+ * @brief Arestas lidas de um trecho do arquivo, na ordem em que aparecem.
+ */
+template<typename Node>
+struct ParsedEdgeChunk {
+    std::vector<Node> sources;
+    std::vector<Node> targets;
+    // Peso de cada aresta; NaN quando a linha não informa peso.
+    std::vector<double> weights;
+    bool has_weights = false;
+
+    /*Esvazia o trecho mantendo a memória já reservada, para ser reaproveitado*/
+    void clear() {
+        sources.clear();
+        targets.clear();
+        weights.clear();
+        has_weights = false;
+    }
+};
+
+/**
+ * @brief Lê uma linha "u,v" ou "u,v,peso" de um arquivo de lista de arestas.
+ *
+ * @param weight Recebe o peso da linha, ou permanece NaN se a linha não informar peso.
+ * @return false se a linha estiver vazia ou mal formada.
+ */
+template<typename Node>
+bool parse_comma_edge_line(std::string_view line, Node& u, Node& v, double& weight) {
+    size_t first_comma = line.find(',');
+    if (first_comma == std::string_view::npos) {
+        return false;
+    }
+    size_t second_comma = line.find(',', first_comma + 1);
+
+    std::string_view target_field = line.substr(first_comma + 1, second_comma == std::string_view::npos
+                                                                   ? std::string_view::npos
+                                                                   : second_comma - first_comma - 1);
+    if (!parse_node_field(line.substr(0, first_comma), u) || !parse_node_field(target_field, v)) {
+        return false;
+    }
+
+    if (second_comma != std::string_view::npos) {
+        std::string_view weight_field = trim_field(line.substr(second_comma + 1));
+        auto result = std::from_chars(weight_field.data(), weight_field.data() + weight_field.size(), weight);
+        if (result.ec != std::errc()) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Lê as arestas de um trecho do arquivo, uma por linha, com o leitor de linha dado.
+ *
+ * @param parse_line Função bool(std::string_view linha, Node& u, Node& v, double& peso) que
+ * retorna false para linhas que não descrevem arestas; o peso começa como NaN em cada linha.
+ */
+template<typename Node, typename LineParser>
+void parse_edge_chunk(const char* begin, const char* end, ParsedEdgeChunk<Node>& chunk, LineParser&& parse_line) {
+    const char* line_begin = begin;
+    while (line_begin < end) {
+        const char* line_end = std::find(line_begin, end, '\n');
+        std::string_view line(line_begin, static_cast<size_t>(line_end - line_begin));
+        line_begin = line_end + 1;
+
+        Node u{}, v{};
+        double weight = std::numeric_limits<double>::quiet_NaN();
+        if (!parse_line(line, u, v, weight)) {
+            continue;
+        }
+        if (!std::isnan(weight)) {
+            chunk.has_weights = true;
+        }
+        chunk.sources.push_back(std::move(u));
+        chunk.targets.push_back(std::move(v));
+        chunk.weights.push_back(weight);
+    }
+}
+
+/**
+ * @brief Lê as linhas "u,v" ou "u,v,peso" de um trecho do arquivo.
+ *
+ * Linhas vazias ou mal formadas são ignoradas.
+ */
+template<typename Node>
+void parse_edge_chunk(const char* begin, const char* end, ParsedEdgeChunk<Node>& chunk) {
+    parse_edge_chunk(begin, end, chunk, parse_comma_edge_line<Node>);
+}
+
+/**
+ * @brief Divide [body, end) em trechos terminados em quebra de linha e os lê em paralelo.
+ *
+ * Trechos com menos de 1 MiB não compensam o custo de criar threads, então arquivos pequenos
+ * são lidos em um único trecho. Uma exceção lançada por uma thread é relançada aqui.
+ * @param num_threads O número máximo de threads; 0 usa o número de núcleos disponíveis.
+ * @return As arestas de cada trecho, na ordem do arquivo.
+ */
+template<typename Node, typename LineParser>
+std::vector<ParsedEdgeChunk<Node>> parse_edge_chunks(const char* body, const char* end, unsigned num_threads,
+                                                     const LineParser& parse_line) {
+    const size_t min_chunk_size = 1 << 20;
+    size_t body_size = static_cast<size_t>(end - body);
+    if (num_threads == 0) {
+        num_threads = std::max(1u, std::thread::hardware_concurrency());
+    }
+    size_t chunk_count = std::max<size_t>(1, std::min<size_t>(num_threads, body_size / min_chunk_size));
+
+    /*Divide o corpo em trechos que começam logo após uma quebra de linha*/
+    std::vector<const char*> bounds(chunk_count + 1, end);
+    bounds[0] = body;
+    for (size_t i = 1; i < chunk_count; ++i) {
+        const char* guess = std::max(bounds[i - 1], body + body_size * i / chunk_count);
+        const char* newline = std::find(guess, end, '\n');
+        bounds[i] = newline == end ? end : newline + 1;
+    }
+
+    std::vector<ParsedEdgeChunk<Node>> chunks(chunk_count);
+    if (chunk_count == 1) {
+        parse_edge_chunk(bounds[0], bounds[1], chunks[0], parse_line);
+        return chunks;
+    }
+
+    std::vector<std::exception_ptr> errors(chunk_count);
+    std::vector<std::thread> workers;
+    workers.reserve(chunk_count);
+    for (size_t i = 0; i < chunk_count; ++i) {
+        workers.emplace_back([&, i]() {
+            try {
+                parse_edge_chunk(bounds[i], bounds[i + 1], chunks[i], parse_line);
+            } catch (...) {
+                errors[i] = std::current_exception();
+            }
+        });
+    }
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+    for (const std::exception_ptr& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+    return chunks;
+}
+
+/**
+ * @brief Repassa as arestas lidas ao construtor na ordem do arquivo, liberando cada trecho.
+ */
+template<typename Node, typename NodeMap>
+void append_edge_chunks(GraphBuilder<Node, NodeMap>& builder, std::vector<ParsedEdgeChunk<Node>>& chunks) {
+    size_t edge_count = 0;
+    for (const auto& chunk : chunks) {
+        edge_count += chunk.sources.size();
+    }
+    builder.reserve_edges(edge_count);
+    for (auto& chunk : chunks) {
+        for (size_t k = 0; k < chunk.sources.size(); ++k) {
+            if (chunk.has_weights && !std::isnan(chunk.weights[k])) {
+                builder.add_edge(chunk.sources[k], chunk.targets[k], chunk.weights[k]);
+            } else {
+                builder.add_edge(chunk.sources[k], chunk.targets[k]);
+            }
+        }
+        chunk = ParsedEdgeChunk<Node>();
+    }
+}
+
+/**
+ * @brief Repassa ao construtor arestas lidas já como índices, de uma só vez.
+ *
+ * Os vetores de cada trecho são movidos para um EdgeIndexBlock, sem cópia, e o construtor
+ * os reúne com GraphBuilder::append_edge_blocks.
+ */
+template<typename Node, typename NodeMap>
+void append_index_chunks(GraphBuilder<Node, NodeMap>& builder, std::vector<ParsedEdgeChunk<int>>& chunks) {
+    std::vector<EdgeIndexBlock> blocks(chunks.size());
+    for (size_t i = 0; i < chunks.size(); ++i) {
+        blocks[i].sources = std::move(chunks[i].sources);
+        blocks[i].targets = std::move(chunks[i].targets);
+        if (chunks[i].has_weights) {
+            blocks[i].weights = std::move(chunks[i].weights);
+        }
+        chunks[i] = ParsedEdgeChunk<int>();
+    }
+    builder.append_edge_blocks(blocks);
+}
+
+/**
+ * @brief Lê um arquivo de lista de arestas em paralelo para um GraphBuilder.
+ *
+ * @details Aceita o formato de populate_graph_from_file e de populate_graph_weighted_from_file:
+ * uma linha de cabeçalho com a ordem do grafo e linhas "u,v" ou "u,v,peso". O arquivo é
+ * mapeado em memória e dividido em trechos que terminam em quebras de linha; cada thread
+ * converte o seu trecho com std::from_chars, sem std::getline nem std::stringstream. Os
+ * trechos são então repassados ao construtor na ordem do arquivo, de modo que o resultado é
+ * o mesmo de uma leitura sequencial.
+ *
+ * Os nós do cabeçalho são registrados com a numeração de create_nodes. Para nós int e char,
+ * cuja numeração é consecutiva, cada thread já converte os nós nos índices do construtor
+ * (veja created_node_index) e as arestas são reunidas com append_edge_blocks, sem consultar
+ * o mapeamento de nós; nós fora do cabeçalho são rejeitados. Para os demais tipos, as
+ * arestas são registradas com add_edge, e nós fora do cabeçalho são acrescentados. Linhas
+ * sem peso recebem peso 1, a menos que a mesma aresta apareça com peso em outra linha. O
+ * construtor usa DenseIdNodeMap, pois os nós são 1..n.
+ *
+ * @tparam Node O tipo de dado dos nós do grafo.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param is_directed Indica se as arestas do arquivo são direcionadas.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return O construtor com os nós e as arestas do arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado, ou se uma aresta
+ * com nós int ou char usar um nó fora do cabeçalho.
+ */
+template<typename Node>
+GraphBuilder<Node, DenseIdNodeMap<Node>> parse_edge_list_file(const std::string& filename, bool is_directed,
+                                                              unsigned num_threads = 0) {
+    MappedFile file(filename);
+    const char* begin = file.data();
+    const char* end = begin + file.size();
+
+    GraphBuilder<Node, DenseIdNodeMap<Node>> builder(is_directed);
+    if (file.size() == 0) {
+        return builder;
+    }
+
+    /*Cabeçalho: a ordem do grafo*/
+    const char* header_end = std::find(begin, end, '\n');
+    std::string_view header = trim_field(std::string_view(begin, static_cast<size_t>(header_end - begin)));
+    int order = 0;
+    std::from_chars(header.data(), header.data() + header.size(), order);
+    create_nodes(builder, order);
+    const char* body = header_end == end ? end : header_end + 1;
+
+    if constexpr (has_created_node_index<Node>) {
+        auto parse_line = [&](std::string_view line, int& u, int& v, double& weight) {
+            Node u_node{}, v_node{};
+            if (!parse_comma_edge_line(line, u_node, v_node, weight)) {
+                return false;
+            }
+            u = created_node_index(u_node, order);
+            v = created_node_index(v_node, order);
+            if (u < 0 || v < 0) {
+                throw std::runtime_error("Edge list line '" + std::string(trim_field(line)) +
+                                         "' uses a node outside the header's order: " + filename);
+            }
+            return true;
+        };
+        auto chunks = parse_edge_chunks<int>(body, end, num_threads, parse_line);
+        append_index_chunks(builder, chunks);
+    } else {
+        auto chunks = parse_edge_chunks<Node>(body, end, num_threads, parse_comma_edge_line<Node>);
+        append_edge_chunks(builder, chunks);
+    }
+    return builder;
+}
+
+/**
+ * @brief Popula um grafo a partir de um arquivo de lista de arestas usando o leitor paralelo.
+ *
+ * Equivale a populate_graph_from_file, mas lê o arquivo com parse_edge_list_file e insere as
+ * arestas de uma só vez. Os pesos, se existirem, são descartados.
+ * @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado.
+ */
+template<typename Node>
+void load_edge_list_file(const std::string& filename, IGraph<Node>& graph, unsigned num_threads = 0) {
+    parse_edge_list_file<Node>(filename, graph.is_directed(), num_threads).build(graph);
+}
+
+/**
+ * @brief Popula um grafo ponderado a partir de um arquivo "u,v,peso" usando o leitor paralelo.
+ *
+ * Equivale a populate_graph_weighted_from_file para IWeightedGraph.
+ * @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado.
+ */
+template<typename Node>
+void load_edge_list_file(const std::string& filename, IWeightedGraph<Node>& graph, unsigned num_threads = 0) {
+    parse_edge_list_file<Node>(filename, graph.is_directed(), num_threads).build(graph);
+}
+
+/**
+ * @brief Lê um arquivo de lista de arestas com rótulos de texto para um GraphBuilder.
+ *
+ * @details As linhas "u,v" ou "u,v,peso" podem ter rótulos quaisquer (URLs, identificadores
+ * de contas, ...). Os trechos do arquivo são lidos em paralelo como std::string_view apontando
+ * para o arquivo mapeado, sem alocar uma std::string por campo; depois, na ordem do arquivo,
+ * cada rótulo é internado no pool uma única vez e as arestas são registradas com os
+ * InternedString correspondentes. Os nós recebem índices na ordem em que aparecem pela
+ * primeira vez. Linhas sem vírgula (como a linha de cabeçalho com a ordem) são ignoradas, então
+ * nós isolados não aparecem no grafo.
+ *
+ * @param filename O caminho para o arquivo de entrada.
+ * @param is_directed Indica se as arestas do arquivo são direcionadas.
+ * @param pool O pool onde os rótulos são internados; deve viver mais que o grafo construído.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return O construtor com os nós e as arestas do arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado.
+ */
+inline GraphBuilder<InternedString> read_labelled_edge_list_file(const std::string& filename, bool is_directed,
+                                                                 StringPool& pool, unsigned num_threads = 0) {
+    MappedFile file(filename);
+    const char* begin = file.data();
+    auto chunks = parse_edge_chunks<std::string_view>(begin, begin + file.size(), num_threads,
+                                                      parse_comma_edge_line<std::string_view>);
+
+    GraphBuilder<InternedString> builder(is_directed);
+    size_t edge_count = 0;
+    for (const auto& chunk : chunks) {
+        edge_count += chunk.sources.size();
+    }
+    builder.reserve_edges(edge_count);
+    for (auto& chunk : chunks) {
+        for (size_t k = 0; k < chunk.sources.size(); ++k) {
+            InternedString u = pool.intern(chunk.sources[k]);
+            InternedString v = pool.intern(chunk.targets[k]);
+            if (chunk.has_weights && !std::isnan(chunk.weights[k])) {
+                builder.add_edge(u, v, chunk.weights[k]);
+            } else {
+                builder.add_edge(u, v);
+            }
+        }
+        chunk = ParsedEdgeChunk<std::string_view>();
+    }
+    return builder;
+}
+
+/**
+ * @brief Popula um grafo com rótulos de texto a partir de um arquivo de lista de arestas.
+ *
+ * Veja read_labelled_edge_list_file. Os pesos, se existirem, são descartados.
+ * @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado.
+ */
+inline void load_labelled_edge_list_file(const std::string& filename, IGraph<InternedString>& graph,
+                                         StringPool& pool, unsigned num_threads = 0) {
+    read_labelled_edge_list_file(filename, graph.is_directed(), pool, num_threads).build(graph);
+}
+
+/**
+ * @brief Popula um grafo ponderado com rótulos de texto a partir de um arquivo "u,v,peso".
+ * @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado.
+ */
+inline void load_labelled_edge_list_file(const std::string& filename, IWeightedGraph<InternedString>& graph,
+                                         StringPool& pool, unsigned num_threads = 0) {
+    read_labelled_edge_list_file(filename, graph.is_directed(), pool, num_threads).build(graph);
+}
+
+/**
+ * @class EdgeListStream
+ * @brief Leitura sequencial de um arquivo de lista de arestas em lotes de tamanho limitado.
+ * @tparam Node O tipo de dado dos nós do grafo.
+ *
+ * O arquivo é lido em blocos de tamanho fixo, e cada bloco é convertido em um lote de arestas
+ * com parse_edge_chunk; a linha incompleta no fim de um bloco é levada para o próximo. A memória
+ * usada é a do bloco mais a do lote, independentemente do tamanho do arquivo, o que permite ler
+ * arquivos maiores que a memória disponível. Aceita linhas "u,v" e "u,v,peso".
+ */
+template<typename Node>
+class EdgeListStream {
+    std::ifstream file;
+    std::vector<char> buffer;
+    // Bytes no início do buffer que pertencem a uma linha ainda não terminada.
+    size_t carry = 0;
+    size_t header_order = 0;
+    bool finished = false;
+
+public:
+    /**
+     * @brief Abre o arquivo e lê a linha de cabeçalho com a ordem do grafo.
+     * @param filename O caminho para o arquivo de entrada.
+     * @param buffer_bytes O tamanho de cada bloco lido do arquivo.
+     * @throws std::runtime_error se o arquivo não puder ser aberto.
+     */
+    explicit EdgeListStream(const std::string& filename, size_t buffer_bytes = 1 << 20)
+        : file(filename, std::ios::binary), buffer(std::max<size_t>(buffer_bytes, 64)) {
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open file: " + filename);
+        }
+        std::string line;
+        std::getline(file, line);
+        std::string_view header = trim_field(line);
+        std::from_chars(header.data(), header.data() + header.size(), header_order);
+    }
+
+    /**
+     * @brief Retorna a ordem informada no cabeçalho do arquivo.
+     */
+    size_t order() const {
+        return header_order;
+    }
+
+    /**
+     * @brief Lê o próximo lote de arestas, substituindo o conteúdo de 'batch'.
+     * @return false quando o arquivo termina e não há mais arestas.
+     */
+    bool next_batch(ParsedEdgeChunk<Node>& batch) {
+        batch.clear();
+        while (batch.sources.empty() && !finished) {
+            file.read(buffer.data() + carry, static_cast<std::streamsize>(buffer.size() - carry));
+            size_t filled = carry + static_cast<size_t>(file.gcount());
+            if (filled < buffer.size()) {
+                // Fim do arquivo: a última linha pode não terminar com quebra de linha.
+                finished = true;
+                parse_edge_chunk(buffer.data(), buffer.data() + filled, batch);
+                carry = 0;
+                break;
+            }
+
+            // Converte apenas as linhas completas do bloco.
+            size_t parsed_bytes = filled;
+            while (parsed_bytes > 0 && buffer[parsed_bytes - 1] != '\n') {
+                --parsed_bytes;
+            }
+            if (parsed_bytes == 0) {
+                // Uma única linha maior que o bloco: aumenta o bloco e continua lendo.
+                carry = filled;
+                buffer.resize(buffer.size() * 2);
+                continue;
+            }
+            parse_edge_chunk(buffer.data(), buffer.data() + parsed_bytes, batch);
+            carry = filled - parsed_bytes;
+            std::memmove(buffer.data(), buffer.data() + parsed_bytes, carry);
+        }
+        return !batch.sources.empty();
+    }
+};
+
+/**
+ * @brief Popula um grafo ponderado lendo o arquivo em lotes, sem matriz de pesos.
+ *
+ * @details Diferente de populate_graph_weighted_from_file com matriz, que aloca ordem² pesos
+ * antes de ler a primeira aresta, os pesos são guardados apenas ao lado de cada aresta do
+ * IWeightedGraph, e o texto do arquivo é lido por EdgeListStream com memória limitada ao tamanho
+ * do bloco. Cada lote é repassado a um GraphBuilder (com DenseIdNodeMap, pois os nós são 1..n),
+ * que guarda apenas os índices e os pesos das arestas; o grafo é construído ao final de uma só
+ * vez, sem a busca por duplicatas de add_edge a cada aresta. Linhas sem peso seguem a mesma
+ * regra de populate_graph_weighted_from_file para IWeightedGraph: recebem peso 1, a menos que
+ * a mesma aresta apareça com peso em outra linha.
+ *
+ * @tparam Node O tipo de dado dos nós do grafo.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param graph O grafo a ser populado.
+ * @param buffer_bytes O tamanho de cada bloco lido do arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto, ou se uma aresta com nós int ou
+ * char usar um nó fora do cabeçalho.
+ */
+template<typename Node>
+void populate_graph_weighted_streaming(const std::string& filename, IWeightedGraph<Node>& graph,
+                                       size_t buffer_bytes = 1 << 20) {
+    EdgeListStream<Node> stream(filename, buffer_bytes);
+    int order = static_cast<int>(stream.order());
+    GraphBuilder<Node, DenseIdNodeMap<Node>> builder(graph.is_directed());
+    create_nodes(builder, order);
+
+    ParsedEdgeChunk<Node> batch;
+    while (stream.next_batch(batch)) {
+        for (size_t k = 0; k < batch.sources.size(); ++k) {
+            int from_index, to_index;
+            if constexpr (has_created_node_index<Node>) {
+                from_index = created_node_index(batch.sources[k], order);
+                to_index = created_node_index(batch.targets[k], order);
+                if (from_index < 0 || to_index < 0) {
+                    throw std::runtime_error("Edge list node outside the header's order: " + filename);
+                }
+            } else {
+                from_index = builder.add_node(batch.sources[k]);
+                to_index = builder.add_node(batch.targets[k]);
+            }
+            if (std::isnan(batch.weights[k])) {
+                builder.add_edge_indices(from_index, to_index);
+            } else {
+                builder.add_edge_indices(from_index, to_index, batch.weights[k]);
+            }
+        }
+    }
+    builder.build(graph);
+}
+
+#endif // EDGE_LIST_PARSER_H
@@ -12,22 +12,21 @@
 #include "../graph/UndirectedAdjacencyMatrixGraph.h"
 #include "../graph/UndirectedIncidenceMatrixGraph.h"
 #include "Bfs.h"
+#include "Components.h"
 
 /**
  * @brief Verifica se um grafo não-direcionado é conectado.
+ *
+ * Usa o union-find de ConnectedComponents, que para assim que todos os nós estão no mesmo
+ * componente, em vez de montar o vetor de todos os nós visitados por uma BFS.
  * @tparam Node O tipo de dado dos nós do grafo.
  * @param graph O grafo a ser verificado.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
  * @return true se o grafo for conectado, false caso contrário.
  */
 template<typename Node>
-bool is_connected(const IGraph<Node>& graph) {
-    if (graph.get_order() <= 1) {
-        return true;
-    }
-
-    /*Se todos os nós são acessíveis a partir de um nó inicial, o grafo é conectado*/
-    std::vector<Node> visited = bfs(graph, graph.get_nodes().front());
-    return visited.size() == graph.get_order();
+bool is_connected(const IGraph<Node>& graph, unsigned num_threads = 0) {
+    return ConnectedComponents<Node>(graph, num_threads).is_connected();
 }
 
 
@@ -43,9 +42,9 @@ void copy_graph(const IGraph<Node>& from, IGraph<Node>& to) {
     for (Node node : from.get_nodes()) {
         to.add_node(node);
 
-        for (Node neighbor : from.get_neighbors(node)) {
-            to.add_edge(node, neighbor);
-        }
+        from.for_each_neighbor(from.get_index(node), [&](int neighbor_index) {
+            to.add_edge(node, from.get_node(neighbor_index));
+        });
     }
 }
 
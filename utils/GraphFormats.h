@@ -0,0 +1,329 @@
+#ifndef GRAPH_FORMATS_H
+#define GRAPH_FORMATS_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <stdexcept>
+#include <charconv>
+#include <algorithm>
+#include <type_traits>
+#include <cctype>
+#include <cmath>
+
+#include "EdgeListParser.h"
+
+/*
+ * Leitores dos formatos usados pelos repositórios públicos de grafos grandes:
+ *
+ *  - DIMACS (.gr, 9th DIMACS Challenge): linhas "c ..." de comentário, o cabeçalho "p sp n m"
+ *    e arcos "a u v peso"; o cabeçalho "p edge n m" com linhas "e u v" descreve grafos não
+ *    direcionados.
+ *  - Matrix Market (.mtx): a linha "%%MatrixMarket matrix coordinate <campo> <simetria>",
+ *    comentários "%", a linha "linhas colunas nnz" e uma entrada "i j [valor]" por linha.
+ *  - SNAP: comentários "#" e uma aresta "u v" por linha, separada por espaços ou tabulação.
+ *
+ * Todos usam o mesmo caminho de parse_edge_list_file: o arquivo é mapeado em memória, o
+ * cabeçalho é lido sequencialmente e o corpo é dividido em trechos lidos em paralelo com
+ * std::from_chars. Em DIMACS e Matrix Market, que declaram os nós 1..n, as threads já
+ * convertem cada nó no seu índice, e os trechos são reunidos no construtor de uma só vez. O
+ * resultado é um GraphBuilder (com DenseIdNodeMap nos formatos que declaram os nós), que
+ * constrói qualquer representação com builder.build(graph) ou CompressedSparseRowGraph(builder).
+ */
+
+/**
+ * @brief Retira de 'line' o próximo campo separado por espaços ou tabulação.
+ * @return O campo, ou uma string vazia se a linha não tiver mais campos.
+ */
+inline std::string_view next_field(std::string_view& line) {
+    auto is_space = [](char c) { return c == ' ' || c == '\t' || c == '\r'; };
+    size_t begin = 0;
+    while (begin < line.size() && is_space(line[begin])) ++begin;
+    size_t end = begin;
+    while (end < line.size() && !is_space(line[end])) ++end;
+    std::string_view field = line.substr(begin, end - begin);
+    line.remove_prefix(end);
+    return field;
+}
+
+/**
+ * @brief Lê "u v" ou "u v peso" separados por espaços, como nas linhas de DIMACS, Matrix Market e SNAP.
+ *
+ * @param read_weight Indica se um terceiro campo deve ser lido como peso.
+ * @return false se a linha não tiver os dois nós ou se o peso for inválido.
+ */
+template<typename Node>
+bool parse_whitespace_edge(std::string_view line, Node& u, Node& v, double& weight, bool read_weight) {
+    if (!parse_node_field(next_field(line), u) || !parse_node_field(next_field(line), v)) {
+        return false;
+    }
+    if (read_weight) {
+        std::string_view weight_field = next_field(line);
+        if (!weight_field.empty()) {
+            auto result = std::from_chars(weight_field.data(), weight_field.data() + weight_field.size(), weight);
+            if (result.ec != std::errc()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Lê um valor inteiro de um campo do cabeçalho de um arquivo.
+ * @throws std::runtime_error se o campo não for um inteiro não negativo.
+ */
+inline size_t parse_header_count(std::string_view field, const std::string& filename) {
+    size_t value = 0;
+    auto result = std::from_chars(field.data(), field.data() + field.size(), value);
+    if (field.empty() || result.ec != std::errc()) {
+        throw std::runtime_error("Invalid graph file header: " + filename);
+    }
+    return value;
+}
+
+/**
+ * @brief Retorna uma cópia do campo em letras minúsculas.
+ */
+inline std::string lowercase_field(std::string_view field) {
+    std::string lower(field);
+    std::transform(lower.begin(), lower.end(), lower.begin(),
+                   [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return lower;
+}
+
+/**
+ * @brief Lê um arquivo DIMACS (.gr) para um GraphBuilder.
+ *
+ * @details "p sp n m" descreve um grafo direcionado com arcos "a u v peso"; "p edge n m" (ou
+ * "p col n m") descreve um grafo não direcionado com arestas "e u v" e peso opcional. Os nós
+ * 1..n são registrados na ordem, então o nó i recebe o índice i - 1, e as linhas de comentário
+ * podem aparecer em qualquer lugar do arquivo. Linhas de outros tipos são ignoradas.
+ *
+ * @tparam Node Um tipo inteiro para os identificadores dos nós.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return O construtor com os nós e as arestas do arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto, não tiver um cabeçalho válido,
+ * tiver uma linha "a" ou "e" mal formada ou um arco com extremidade fora de 1..n.
+ */
+template<typename Node>
+GraphBuilder<Node, DenseIdNodeMap<Node>> read_dimacs_file(const std::string& filename, unsigned num_threads = 0) {
+    static_assert(std::is_integral_v<Node>, "read_dimacs_file: node ids must be integers");
+
+    MappedFile file(filename);
+    const char* end = file.data() + file.size();
+
+    /*Cabeçalho: a primeira linha "p" depois dos comentários*/
+    const char* body = file.data();
+    std::string_view header;
+    while (body < end && header.empty()) {
+        const char* line_end = std::find(body, end, '\n');
+        std::string_view line = trim_field(std::string_view(body, static_cast<size_t>(line_end - body)));
+        body = line_end == end ? end : line_end + 1;
+        if (line.empty() || line.front() == 'c') {
+            continue;
+        }
+        if (line.front() != 'p') {
+            break;
+        }
+        header = line;
+    }
+    if (header.empty()) {
+        throw std::runtime_error("Invalid graph file header: " + filename);
+    }
+
+    next_field(header);
+    std::string problem = lowercase_field(next_field(header));
+    size_t order = parse_header_count(next_field(header), filename);
+    bool is_directed;
+    if (problem == "sp") {
+        is_directed = true;
+    } else if (problem == "edge" || problem == "col") {
+        is_directed = false;
+    } else {
+        throw std::runtime_error("Unsupported DIMACS problem type '" + problem + "': " + filename);
+    }
+
+    GraphBuilder<Node, DenseIdNodeMap<Node>> builder(is_directed);
+    for (size_t i = 1; i <= order; ++i) {
+        builder.add_node(static_cast<Node>(i));
+    }
+
+    /*Cada thread já converte os nós 1..n nos índices 0..n-1 do construtor*/
+    auto parse_line = [&](std::string_view line, int& u_index, int& v_index, double& weight) {
+        std::string_view fields = line;
+        std::string_view kind = next_field(fields);
+        if (kind != "a" && kind != "e") {
+            return false;
+        }
+        Node u{}, v{};
+        if (!parse_whitespace_edge(fields, u, v, weight, true)) {
+            throw std::runtime_error("Malformed DIMACS line '" + std::string(trim_field(line)) + "': " + filename);
+        }
+        if (u < 1 || static_cast<size_t>(u) > order || v < 1 || static_cast<size_t>(v) > order) {
+            throw std::runtime_error("DIMACS arc out of range (" + std::to_string(u) + ", " +
+                                     std::to_string(v) + "): " + filename);
+        }
+        u_index = static_cast<int>(u - 1);
+        v_index = static_cast<int>(v - 1);
+        return true;
+    };
+    auto chunks = parse_edge_chunks<int>(body, end, num_threads, parse_line);
+    append_index_chunks(builder, chunks);
+    return builder;
+}
+
+/**
+ * @brief Lê uma matriz esparsa Matrix Market (.mtx) em formato de coordenadas para um GraphBuilder.
+ *
+ * @details Cada entrada "i j valor" vira um arco de i para j com o valor como peso; o campo
+ * "pattern" não tem valores, e as arestas ficam sem peso. Matrizes "general" geram grafos
+ * direcionados; "symmetric" e "hermitian" guardam apenas um triângulo e geram grafos não
+ * direcionados, com o peso da entrada armazenada. Em "skew-symmetric", a entrada espelhada vale
+ * -valor, então o grafo é direcionado e cada entrada "i j valor" gera também o arco de j para i
+ * com peso -valor. Os nós 1..max(linhas, colunas) são registrados na ordem, então o nó i recebe
+ * o índice i - 1.
+ *
+ * @tparam Node Um tipo inteiro para os identificadores dos nós.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return O construtor com os nós e as arestas do arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto, não for uma matriz em
+ * coordenadas, tiver valores complexos ou tiver uma entrada fora das linhas e colunas declaradas.
+ */
+template<typename Node>
+GraphBuilder<Node, DenseIdNodeMap<Node>> read_matrix_market_file(const std::string& filename,
+                                                                 unsigned num_threads = 0) {
+    static_assert(std::is_integral_v<Node>, "read_matrix_market_file: node ids must be integers");
+
+    MappedFile file(filename);
+    const char* body = file.data();
+    const char* end = body + file.size();
+
+    auto next_line = [&]() {
+        const char* line_end = std::find(body, end, '\n');
+        std::string_view line = trim_field(std::string_view(body, static_cast<size_t>(line_end - body)));
+        body = line_end == end ? end : line_end + 1;
+        return line;
+    };
+
+    /*Linha de identificação: %%MatrixMarket matrix coordinate <campo> <simetria>*/
+    std::string_view banner = next_line();
+    if (lowercase_field(next_field(banner)) != "%%matrixmarket" || lowercase_field(next_field(banner)) != "matrix") {
+        throw std::runtime_error("Invalid graph file header: " + filename);
+    }
+    std::string format = lowercase_field(next_field(banner));
+    std::string field = lowercase_field(next_field(banner));
+    std::string symmetry = lowercase_field(next_field(banner));
+    if (format != "coordinate") {
+        throw std::runtime_error("Unsupported Matrix Market format '" + format + "': " + filename);
+    }
+    if (field != "real" && field != "integer" && field != "pattern") {
+        throw std::runtime_error("Unsupported Matrix Market field '" + field + "': " + filename);
+    }
+    bool is_skew = symmetry == "skew-symmetric";
+    bool is_directed = symmetry == "general" || is_skew;
+    if (symmetry != "general" && !is_skew && symmetry != "symmetric" && symmetry != "hermitian") {
+        throw std::runtime_error("Unsupported Matrix Market symmetry '" + symmetry + "': " + filename);
+    }
+    /*Sem valores, não há como negar o peso da entrada espelhada*/
+    if (is_skew && field == "pattern") {
+        throw std::runtime_error("Unsupported Matrix Market field 'pattern' for skew-symmetric matrices: " + filename);
+    }
+
+    /*Linha de tamanho, depois dos comentários*/
+    std::string_view size_line;
+    while (body < end && size_line.empty()) {
+        size_line = next_line();
+        if (!size_line.empty() && size_line.front() == '%') {
+            size_line = std::string_view();
+        }
+    }
+    size_t rows = parse_header_count(next_field(size_line), filename);
+    size_t columns = parse_header_count(next_field(size_line), filename);
+
+    GraphBuilder<Node, DenseIdNodeMap<Node>> builder(is_directed);
+    for (size_t i = 1; i <= std::max(rows, columns); ++i) {
+        builder.add_node(static_cast<Node>(i));
+    }
+
+    bool read_weight = field != "pattern";
+    /*Cada thread já converte os nós 1..n nos índices 0..n-1 do construtor*/
+    auto parse_line = [&](std::string_view line, int& u_index, int& v_index, double& weight) {
+        if (!line.empty() && line.front() == '%') {
+            return false;
+        }
+        Node u{}, v{};
+        if (!parse_whitespace_edge(line, u, v, weight, read_weight)) {
+            return false;
+        }
+        if (u < 1 || static_cast<size_t>(u) > rows || v < 1 || static_cast<size_t>(v) > columns) {
+            throw std::runtime_error("Matrix Market entry out of range (" + std::to_string(u) + ", " +
+                                     std::to_string(v) + "): " + filename);
+        }
+        if (is_skew && std::isnan(weight)) {
+            throw std::runtime_error("Matrix Market entry without a value (" + std::to_string(u) + ", " +
+                                     std::to_string(v) + "): " + filename);
+        }
+        u_index = static_cast<int>(u - 1);
+        v_index = static_cast<int>(v - 1);
+        return true;
+    };
+    auto chunks = parse_edge_chunks<int>(body, end, num_threads, parse_line);
+    if (!is_skew) {
+        append_index_chunks(builder, chunks);
+        return builder;
+    }
+
+    /*Cada entrada gera o arco armazenado e o espelhado, com o peso negado*/
+    size_t entry_count = 0;
+    for (const auto& chunk : chunks) {
+        entry_count += chunk.sources.size();
+    }
+    builder.reserve_edges(2 * entry_count);
+    for (auto& chunk : chunks) {
+        for (size_t k = 0; k < chunk.sources.size(); ++k) {
+            builder.add_edge_indices(chunk.sources[k], chunk.targets[k], chunk.weights[k]);
+            if (chunk.sources[k] != chunk.targets[k]) {
+                builder.add_edge_indices(chunk.targets[k], chunk.sources[k], -chunk.weights[k]);
+            }
+        }
+        chunk = ParsedEdgeChunk<int>();
+    }
+    return builder;
+}
+
+/**
+ * @brief Lê uma lista de arestas no formato do SNAP para um GraphBuilder.
+ *
+ * @details Linhas que começam com '#' ou '%' são comentários, e as demais têm "u v" ou
+ * "u v peso" separados por espaços ou tabulação. O formato não informa a ordem nem se as
+ * arestas são direcionadas; os nós recebem índices na ordem em que aparecem pela primeira vez.
+ *
+ * @tparam Node O tipo de dado dos nós do grafo.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param is_directed Indica se as arestas do arquivo são direcionadas.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return O construtor com os nós e as arestas do arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado.
+ */
+template<typename Node>
+GraphBuilder<Node> read_snap_file(const std::string& filename, bool is_directed = true, unsigned num_threads = 0) {
+    MappedFile file(filename);
+    const char* begin = file.data();
+
+    GraphBuilder<Node> builder(is_directed);
+    auto parse_line = [](std::string_view line, Node& u, Node& v, double& weight) {
+        line = trim_field(line);
+        if (line.empty() || line.front() == '#' || line.front() == '%') {
+            return false;
+        }
+        return parse_whitespace_edge(line, u, v, weight, true);
+    };
+    auto chunks = parse_edge_chunks<Node>(begin, begin + file.size(), num_threads, parse_line);
+    append_edge_chunks(builder, chunks);
+    return builder;
+}
+
+#endif // GRAPH_FORMATS_H
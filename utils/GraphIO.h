@@ -8,10 +8,29 @@
 #include <algorithm>
 #include <iostream>
 #include <iomanip>
+#include <limits>
+#include <chrono>
 
 #include "Dfs.h"
 #include "../graph/UndirectedAdjacencyListGraph.h"
 #include "../graph/UndirectedAdjacencyMatrixGraph.h"
+#include "../graph/IWeightedGraph.h"
+#include "../graph/GraphBuilder.h"
+#include "ResultWriter.h"
+#include "CreateNodes.h"
+#include "EdgeListParser.h"
+#include "GraphFormats.h"
+#include "PipelinedLoader.h"
+
+/*
+ * Incluir este arquivo também disponibiliza os leitores com arquivo mapeado em memória e
+ * conversão em paralelo: parse_edge_list_file, load_edge_list_file e os leitores de arestas
+ * rotuladas (EdgeListParser.h), para este mesmo formato, e read_dimacs_file,
+ * read_matrix_market_file e read_snap_file (GraphFormats.h), para os formatos dos
+ * repositórios públicos de grafos. As funções populate_* que recebem um LoadMode, no fim do
+ * arquivo, leem o mesmo formato com leitura, conversão e inserção em threads concorrentes
+ * (EdgeListPipeline, em PipelinedLoader.h) e medem a vazão de cada etapa.
+ */
 
 /**
  * @brief Popula um grafo com dados de um arquivo de texto.
@@ -59,6 +78,73 @@ void populate_graph_from_file(const std::string& filename, IGraph<Node>& graph)
     file.close();
 }
 
+/**
+ * @brief Lê um arquivo no formato de populate_graph_from_file para um GraphBuilder.
+ *
+ * @details Os nós do cabeçalho são registrados primeiro, com os mesmos valores de create_nodes,
+ * e as arestas são apenas acumuladas. Construir o grafo depois, com builder.build(graph) ou
+ * CompressedSparseRowGraph(builder), remove as arestas repetidas de uma só vez, enquanto
+ * populate_graph_from_file paga uma busca na vizinhança a cada linha. As arestas ficam
+ * agrupadas por nó de origem, então representações que numeram arestas (listas e matrizes
+ * de incidência) podem numerá-las em outra ordem que a do arquivo.
+ *
+ * Como os nós são 1..n, o construtor usa DenseIdNodeMap. Para nós int e char, cada nó é
+ * convertido direto no seu índice (veja created_node_index), e nós fora do cabeçalho são
+ * rejeitados, como em parse_edge_list_file.
+ *
+ * @tparam Node O tipo de dado dos nós do grafo.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param is_directed Indica se as arestas do arquivo são direcionadas.
+ * @return O construtor com os nós e as arestas do arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto ou se uma aresta com nós int ou
+ * char usar um nó fora do cabeçalho.
+ */
+template<typename Node>
+GraphBuilder<Node, DenseIdNodeMap<Node>> read_edge_list_file(const std::string& filename, bool is_directed) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    GraphBuilder<Node, DenseIdNodeMap<Node>> builder(is_directed);
+    std::string line;
+    std::getline(file, line);
+    int order = std::stoi(line);
+    create_nodes(builder, order);
+
+    while (std::getline(file, line)) {
+        if (line.empty()) continue;
+
+        std::stringstream ss(line);
+        std::string part1, part2;
+
+        if (std::getline(ss, part1, ',') && std::getline(ss, part2)) {
+            std::stringstream s1(part1);
+            std::stringstream s2(part2);
+
+            Node u, v;
+            s1 >> u;
+            s2 >> v;
+
+            if constexpr (has_created_node_index<Node>) {
+                int u_index = created_node_index(u, order);
+                int v_index = created_node_index(v, order);
+                if (u_index < 0 || v_index < 0) {
+                    throw std::runtime_error("Edge list line '" + line + "' uses a node outside the header's order: " +
+                                             filename);
+                }
+                builder.add_edge_indices(u_index, v_index);
+            } else {
+                builder.add_edge(u, v);
+            }
+        }
+    }
+
+    return builder;
+}
+
+/*Preenche também uma matriz de pesos ordem x ordem, alocada antes da leitura. Para grafos grandes,
+  populate_graph_weighted_streaming (EdgeListParser.h) guarda os pesos junto às arestas de um IWeightedGraph*/
 template<typename Node>
 void populate_graph_weighted_from_file(const std::string& filename, IGraph<Node>& graph, 
                                         std::vector<std::vector<double>>& weights, bool is_directed = true) {
@@ -84,22 +170,27 @@ void populate_graph_weighted_from_file(const std::string& filename, IGraph<Node>
         std::stringstream ss(line);
         std::string part1, part2, part3;
 
-        if (std::getline(ss, part1, ',') && std::getline(ss, part2, ',') && std::getline(ss, part3)) {
+        if (std::getline(ss, part1, ',') && std::getline(ss, part2, ',')) {
             std::stringstream s1(part1);
             std::stringstream s2(part2);
-            std::stringstream s3(part3);
 
             Node u, v;
-            double weight;
             s1 >> u;
             s2 >> v;
-            s3 >> weight;
 
             graph.add_edge(u, v);
 
             int index_u = graph.get_index(u);
             int index_v = graph.get_index(v);
 
+            /*Linhas "u,v" sem peso valem peso 1, sem substituir um peso já lido para a aresta*/
+            double weight = weights[index_u][index_v];
+            if (std::getline(ss, part3)) {
+                std::stringstream(part3) >> weight;
+            } else if (weight == std::numeric_limits<double>::infinity()) {
+                weight = 1.0;
+            }
+
             weights[index_u][index_v] = weight;
 
             if(!is_directed) {
@@ -111,9 +202,77 @@ void populate_graph_weighted_from_file(const std::string& filename, IGraph<Node>
 
 }
 
+/**
+ * @brief Popula um grafo ponderado com dados de um arquivo de texto.
+ *
+ * @details Usa o mesmo formato de arquivo da versão com matriz de pesos: uma linha de
+ * cabeçalho com a ordem e linhas seguintes no formato "u,v,w". O peso de cada aresta é
+ * armazenado no próprio grafo, junto à aresta, de modo que nenhuma matriz ordem x ordem
+ * é alocada. Se o grafo for não-direcionado, o peso vale para os dois sentidos da aresta.
+ *
+ * Todos os leitores ponderados seguem a mesma regra para linhas "u,v" sem peso: a aresta
+ * recebe peso 1, a menos que o arquivo informe um peso para ela em outra linha. Quando a
+ * mesma aresta aparece com pesos diferentes, prevalece o último.
+ *
+ * @tparam Node O tipo de dado dos nós do grafo.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param graph O grafo ponderado a ser populado.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
+template<typename Node>
+void populate_graph_weighted_from_file(const std::string& filename, IWeightedGraph<Node>& graph) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+
+    std::string line;
+    size_t order;
+
+    std::getline(file, line);
+    std::stringstream ss_order(line);
+
+    ss_order >> order;
+    create_nodes(graph, order);
+
+    while(std::getline(file, line)) {
+        if (line.empty()) continue;
+
+        std::stringstream ss(line);
+        std::string part1, part2, part3;
+
+        if (std::getline(ss, part1, ',') && std::getline(ss, part2, ',')) {
+            std::stringstream s1(part1);
+            std::stringstream s2(part2);
+
+            Node u, v;
+            s1 >> u;
+            s2 >> v;
+
+            if (std::getline(ss, part3)) {
+                double weight;
+                std::stringstream(part3) >> weight;
+                graph.add_edge(u, v, weight);
+            } else {
+                /*Sem peso, add_edge cria a aresta com peso 1 ou mantém o peso que ela já tem*/
+                graph.add_edge(u, v);
+            }
+        }
+    }
+    file.close();
+}
+
+/**
+ * @brief Imprime a matriz de pesos como tabela, apenas para grafos pequenos.
+ *
+ * Para grafos maiores que PRETTY_PRINT_MAX_ORDER, exporte a matriz com write_distances_matrix.
+ */
 template<typename Node>
 void print_weights_matrix(const std::vector<std::vector<double>>& weights, const IGraph<Node>& graph) {
     size_t order = graph.get_order();
+    if (skip_pretty_print("Weights Matrix", order)) {
+        return;
+    }
 
     std::cout << "Weights Matrix:\n";
 
@@ -182,25 +341,63 @@ void remove_node_from_string(const std::string& str, IGraph<Node>& graph) {
     std::stringstream ss(str);
     ss >> node;
     graph.remove_node(node);
-} 
+}
 
+/**
+ * @enum LoadMode
+ * @brief Modo de leitura das funções populate_* que recebem um LoadMode.
+ *
+ * SERIAL lê, converte e insere uma linha por vez, como populate_graph_from_file; PIPELINED usa
+ * EdgeListPipeline, com as três etapas em threads diferentes.
+ */
+enum class LoadMode { SERIAL, PIPELINED };
+
+/**
+ * @brief Popula um grafo com dados de um arquivo de texto, no modo de leitura escolhido.
+ *
+ * Na leitura sequencial, stats recebe apenas o tempo total, contado como etapa de construção.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param graph O grafo a ser populado.
+ * @param mode O modo de leitura.
+ * @param stats Se não for nulo, recebe o tempo e o volume de cada etapa.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
 template<typename Node>
-void create_nodes(IGraph<Node>& graph, const int num_nodes) {
-    using U = std::remove_cv_t<Node>; // remove const/volatile e referências
-    if constexpr (std::is_same_v<U, char>) {
-        char start_char = 'A';
-        for (int i = 0; i < num_nodes; ++i) {
-        graph.add_node(static_cast<Node>(start_char + i));
-    }
-    } else if constexpr (std::is_same_v<U, int>) {
-        int start_int = 1;
-        for (int i = 0; i < num_nodes; ++i) {
-        graph.add_node(static_cast<Node>(start_int + i));
-    }
-    } else {
-        std::cout << "Node é outro tipo\n";
+void populate_graph_from_file(const std::string& filename, IGraph<Node>& graph, LoadMode mode,
+                              LoadStats* stats = nullptr) {
+    if (mode == LoadMode::PIPELINED) {
+        populate_graph_pipelined(filename, graph, PipelineOptions(), stats);
         return;
     }
+    auto start = std::chrono::steady_clock::now();
+    populate_graph_from_file(filename, graph);
+    if (stats != nullptr) {
+        *stats = LoadStats();
+        stats->total_seconds = stats->build_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
+}
+
+/**
+ * @brief Popula um grafo ponderado a partir de um arquivo "u,v,peso", no modo de leitura escolhido.
+ *
+ * Na leitura sequencial, stats recebe apenas o tempo total, contado como etapa de construção.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
+template<typename Node>
+void populate_graph_weighted_from_file(const std::string& filename, IWeightedGraph<Node>& graph, LoadMode mode,
+                                       LoadStats* stats = nullptr) {
+    if (mode == LoadMode::PIPELINED) {
+        populate_graph_pipelined(filename, graph, PipelineOptions(), stats);
+        return;
+    }
+    auto start = std::chrono::steady_clock::now();
+    populate_graph_weighted_from_file(filename, graph);
+    if (stats != nullptr) {
+        *stats = LoadStats();
+        stats->total_seconds = stats->build_seconds =
+            std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    }
 }
 
 #endif // GRAPH_IO_H
@@ -0,0 +1,491 @@
+#ifndef GRAPH_SNAPSHOT_H
+#define GRAPH_SNAPSHOT_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <fstream>
+#include <iostream>
+#include <algorithm>
+#include <numeric>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <type_traits>
+
+#include "MappedFile.h"
+#include "../graph/IWeightedGraph.h"
+
+/**
+ * @struct SnapshotHeader
+ * @brief Cabeçalho de 64 bytes no início de um arquivo de snapshot de grafo.
+ *
+ * Depois do cabeçalho vêm as seções, cada uma começando em uma posição múltipla de 8 bytes:
+ * deslocamentos (uint64, ordem + 1), graus de entrada (uint64, ordem), vizinhos (int32, arcos),
+ * pesos (double, arcos; apenas em grafos ponderados), nós (Node, ordem) e os índices dos nós
+ * ordenados pelo valor do nó (int32, ordem), usados para buscar o índice de um nó sem tabela hash.
+ */
+struct SnapshotHeader {
+    char magic[8];
+    uint32_t version;
+    // Valor fixo que permite detectar um arquivo gravado em outra ordem de bytes.
+    uint32_t byte_order;
+    uint32_t flags;
+    // Tamanho e categoria (0 inteiro com sinal, 1 sem sinal, 2 ponto flutuante) do tipo Node.
+    uint32_t node_size;
+    uint32_t node_kind;
+    uint32_t reserved;
+    uint64_t order;
+    uint64_t arc_count;
+    uint64_t edge_count;
+    uint64_t reserved2;
+};
+static_assert(sizeof(SnapshotHeader) == 64, "SnapshotHeader must have 64 bytes");
+
+namespace snapshot_format {
+    constexpr char MAGIC[8] = {'G', 'R', 'A', 'P', 'H', 'S', 'N', 'P'};
+    constexpr uint32_t VERSION = 1;
+    constexpr uint32_t BYTE_ORDER_MARK = 0x01020304;
+    constexpr uint32_t FLAG_DIRECTED = 1;
+    constexpr uint32_t FLAG_WEIGHTED = 2;
+
+    /*Arredonda um tamanho em bytes para o próximo múltiplo de 8*/
+    inline uint64_t aligned(uint64_t bytes) {
+        return (bytes + 7) & ~uint64_t(7);
+    }
+
+    template<typename Node>
+    constexpr uint32_t node_kind() {
+        return std::is_floating_point_v<Node> ? 2 : (std::is_signed_v<Node> ? 0 : 1);
+    }
+
+    /*Posição, a partir do início do arquivo, de cada seção*/
+    struct Layout {
+        uint64_t offsets, in_degrees, neighbors, weights, nodes, sorted_nodes, total;
+    };
+
+    template<typename Node>
+    Layout layout(uint64_t order, uint64_t arc_count, bool weighted) {
+        Layout l;
+        l.offsets = sizeof(SnapshotHeader);
+        l.in_degrees = l.offsets + aligned((order + 1) * sizeof(uint64_t));
+        l.neighbors = l.in_degrees + aligned(order * sizeof(uint64_t));
+        l.weights = l.neighbors + aligned(arc_count * sizeof(int32_t));
+        l.nodes = l.weights + (weighted ? aligned(arc_count * sizeof(double)) : 0);
+        l.sorted_nodes = l.nodes + aligned(order * sizeof(Node));
+        l.total = l.sorted_nodes + aligned(order * sizeof(int32_t));
+        return l;
+    }
+
+    /*Grava um vetor e completa com zeros até o próximo múltiplo de 8 bytes*/
+    template<typename T>
+    void write_section(std::ofstream& out, const std::vector<T>& values) {
+        uint64_t bytes = values.size() * sizeof(T);
+        out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(bytes));
+        static const char padding[8] = {};
+        out.write(padding, static_cast<std::streamsize>(aligned(bytes) - bytes));
+    }
+}
+
+/**
+ * @brief Grava um grafo em um arquivo de snapshot binário.
+ *
+ * Os nós mantêm os índices do grafo, e os vizinhos de cada nó, a mesma ordem. Se o grafo for
+ * ponderado (IWeightedGraph) ou 'weight_matrix' for informada, os pesos também são gravados.
+ * Apenas tipos de nó numéricos (int, char, ...) são suportados, pois os nós são gravados e
+ * lidos diretamente na sua representação em memória.
+ *
+ * @tparam Node O tipo de dado dos nós do grafo.
+ * @param graph O grafo a ser gravado.
+ * @param filename O caminho do arquivo de saída.
+ * @param weight_matrix Matriz de pesos opcional, indexada pelos índices dos nós do grafo.
+ * @throws std::runtime_error se o arquivo não puder ser gravado.
+ */
+template<typename Node>
+void save_graph_snapshot(const IGraph<Node>& graph, const std::string& filename,
+                         const std::vector<std::vector<double>>* weight_matrix = nullptr) {
+    static_assert(std::is_arithmetic_v<Node>, "save_graph_snapshot: Node must be an arithmetic type");
+
+    auto weighted_graph = dynamic_cast<const IWeightedGraph<Node>*>(&graph);
+    bool weighted = weighted_graph != nullptr || weight_matrix != nullptr;
+    size_t order = graph.get_order();
+
+    std::vector<uint64_t> offsets(order + 1, 0);
+    std::vector<uint64_t> in_degrees(order, 0);
+    std::vector<int32_t> neighbors;
+    std::vector<double> weights;
+    for (size_t i = 0; i < order; ++i) {
+        if (weighted_graph != nullptr && weight_matrix == nullptr) {
+            weighted_graph->for_each_weighted_neighbor(static_cast<int>(i), [&](int neighbor_index, double weight) {
+                neighbors.push_back(neighbor_index);
+                weights.push_back(weight);
+            });
+        } else {
+            graph.for_each_neighbor(static_cast<int>(i), [&](int neighbor_index) {
+                neighbors.push_back(neighbor_index);
+                if (weight_matrix != nullptr) {
+                    weights.push_back((*weight_matrix)[i][neighbor_index]);
+                }
+            });
+        }
+        offsets[i + 1] = neighbors.size();
+    }
+    for (int32_t neighbor_index : neighbors) {
+        in_degrees[neighbor_index]++;
+    }
+
+    std::vector<Node> nodes = graph.get_nodes();
+    std::vector<int32_t> sorted_nodes(order);
+    std::iota(sorted_nodes.begin(), sorted_nodes.end(), 0);
+    std::sort(sorted_nodes.begin(), sorted_nodes.end(), [&](int32_t a, int32_t b) { return nodes[a] < nodes[b]; });
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, snapshot_format::MAGIC, sizeof(header.magic));
+    header.version = snapshot_format::VERSION;
+    header.byte_order = snapshot_format::BYTE_ORDER_MARK;
+    header.flags = (graph.is_directed() ? snapshot_format::FLAG_DIRECTED : 0) |
+                   (weighted ? snapshot_format::FLAG_WEIGHTED : 0);
+    header.node_size = sizeof(Node);
+    header.node_kind = snapshot_format::node_kind<Node>();
+    header.order = order;
+    header.arc_count = neighbors.size();
+    header.edge_count = graph.get_size();
+
+    std::ofstream out(filename, std::ios::binary | std::ios::trunc);
+    if (!out.is_open()) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    snapshot_format::write_section(out, offsets);
+    snapshot_format::write_section(out, in_degrees);
+    snapshot_format::write_section(out, neighbors);
+    if (weighted) {
+        snapshot_format::write_section(out, weights);
+    }
+    snapshot_format::write_section(out, nodes);
+    snapshot_format::write_section(out, sorted_nodes);
+    if (!out) {
+        throw std::runtime_error("Could not write file: " + filename);
+    }
+}
+
+/**
+ * @brief Grava um grafo e a sua matriz de pesos, como preenchidos por populate_graph_weighted_from_file.
+ */
+template<typename Node>
+void save_graph_snapshot(const IGraph<Node>& graph, const std::vector<std::vector<double>>& weight_matrix,
+                         const std::string& filename) {
+    save_graph_snapshot(graph, filename, &weight_matrix);
+}
+
+/**
+ * @class SnapshotGraph
+ * @brief Grafo imutável lido de um snapshot binário sem desserialização.
+ * @tparam Node O tipo de dado para cada nó do grafo; deve ser o mesmo usado na gravação.
+ *
+ * O arquivo é mapeado em memória e os vetores de deslocamentos, vizinhos, pesos e nós são
+ * usados diretamente das páginas mapeadas, no mesmo formato da CompressedSparseRowGraph.
+ * Abrir o snapshot custa apenas a validação do cabeçalho, independentemente do tamanho do
+ * grafo; as páginas são carregadas pelo sistema operacional à medida que são acessadas.
+ * O índice de um nó é encontrado por busca binária na seção de nós ordenados.
+ *
+ * Assim como a CompressedSparseRowGraph, as operações de inserção e remoção lançam std::logic_error.
+ */
+template<typename Node>
+class SnapshotGraph : public IWeightedGraph<Node> {
+public:
+    using IWeightedGraph<Node>::add_edge;
+
+protected:
+    // Mantém o arquivo mapeado enquanto o grafo existir.
+    std::unique_ptr<MappedFile> file;
+    const uint64_t* offsets = nullptr;
+    const uint64_t* in_degrees = nullptr;
+    const int32_t* neighbors = nullptr;
+    // Nulo em snapshots sem pesos, em que todas as arestas têm peso 1.
+    const double* weights = nullptr;
+    const Node* nodes = nullptr;
+    const int32_t* sorted_nodes = nullptr;
+    size_t order = 0;
+    size_t edge_count = 0;
+    bool directed = true;
+
+    void check_index(int index, const char* message) const {
+        if (index < 0 || static_cast<size_t>(index) >= order) {
+            throw std::out_of_range(message);
+        }
+    }
+
+public:
+    /**
+     * @brief Abre um snapshot gravado por save_graph_snapshot.
+     * @param filename O caminho do arquivo.
+     * @throws std::runtime_error se o arquivo não puder ser lido, não for um snapshot válido,
+     * tiver uma versão não suportada, tiver sido gravado com outro tipo de nó ou declarar mais
+     * nós ou arcos do que cabem no arquivo.
+     *
+     * Apenas o cabeçalho é validado; o conteúdo das seções pode ser conferido com verify.
+     */
+    explicit SnapshotGraph(const std::string& filename)
+        : file(std::make_unique<MappedFile>(filename)) {
+        static_assert(std::is_arithmetic_v<Node>, "SnapshotGraph: Node must be an arithmetic type");
+
+        if (file->size() < sizeof(SnapshotHeader)) {
+            throw std::runtime_error("Invalid graph snapshot: " + filename);
+        }
+        const char* base = file->data();
+        SnapshotHeader header;
+        std::memcpy(&header, base, sizeof(header));
+        if (std::memcmp(header.magic, snapshot_format::MAGIC, sizeof(header.magic)) != 0 ||
+            header.byte_order != snapshot_format::BYTE_ORDER_MARK) {
+            throw std::runtime_error("Invalid graph snapshot: " + filename);
+        }
+        if (header.version != snapshot_format::VERSION) {
+            throw std::runtime_error("Unsupported graph snapshot version " + std::to_string(header.version) + ": " + filename);
+        }
+        if (header.node_size != sizeof(Node) || header.node_kind != snapshot_format::node_kind<Node>()) {
+            throw std::runtime_error("Graph snapshot node type does not match: " + filename);
+        }
+
+        /*Cada nó ocupa ao menos 8 bytes de deslocamento e cada arco 4 bytes de vizinho. Limitar os
+          contadores pelo tamanho do arquivo antes de calcular as seções evita que as multiplicações
+          de layout transbordem e apontem para fora do arquivo. Índices de nós são int32*/
+        if (header.order > file->size() / sizeof(uint64_t) || header.arc_count > file->size() / sizeof(int32_t) ||
+            header.order > static_cast<uint64_t>(std::numeric_limits<int32_t>::max())) {
+            throw std::runtime_error("Truncated graph snapshot: " + filename);
+        }
+
+        bool weighted = (header.flags & snapshot_format::FLAG_WEIGHTED) != 0;
+        auto layout = snapshot_format::layout<Node>(header.order, header.arc_count, weighted);
+        if (file->size() < layout.total) {
+            throw std::runtime_error("Truncated graph snapshot: " + filename);
+        }
+
+        order = header.order;
+        edge_count = header.edge_count;
+        directed = (header.flags & snapshot_format::FLAG_DIRECTED) != 0;
+        offsets = reinterpret_cast<const uint64_t*>(base + layout.offsets);
+        in_degrees = reinterpret_cast<const uint64_t*>(base + layout.in_degrees);
+        neighbors = reinterpret_cast<const int32_t*>(base + layout.neighbors);
+        weights = weighted ? reinterpret_cast<const double*>(base + layout.weights) : nullptr;
+        nodes = reinterpret_cast<const Node*>(base + layout.nodes);
+        sorted_nodes = reinterpret_cast<const int32_t*>(base + layout.sorted_nodes);
+        if (offsets[order] != header.arc_count) {
+            throw std::runtime_error("Invalid graph snapshot: " + filename);
+        }
+    }
+
+    /**
+     * @brief Confere o conteúdo das seções, em O(V + E).
+     *
+     * Verifica que os deslocamentos são crescentes e terminam no número de arcos, que os
+     * vizinhos e os índices ordenados estão entre 0 e a ordem e que a seção de nós ordenados
+     * está de fato ordenada. Depois disso, nenhuma operação do grafo lê fora do arquivo, mesmo
+     * que ele tenha sido corrompido ou gravado por outro programa.
+     * @throws std::runtime_error se alguma seção for inconsistente.
+     */
+    void verify() const {
+        if (offsets[0] != 0) {
+            throw std::runtime_error("Corrupt graph snapshot: offsets do not start at 0");
+        }
+        for (size_t i = 0; i < order; ++i) {
+            if (offsets[i + 1] < offsets[i]) {
+                throw std::runtime_error("Corrupt graph snapshot: offsets are not increasing");
+            }
+        }
+        for (uint64_t k = 0; k < offsets[order]; ++k) {
+            if (neighbors[k] < 0 || static_cast<size_t>(neighbors[k]) >= order) {
+                throw std::runtime_error("Corrupt graph snapshot: neighbor index out of range");
+            }
+        }
+        for (size_t i = 0; i < order; ++i) {
+            if (sorted_nodes[i] < 0 || static_cast<size_t>(sorted_nodes[i]) >= order) {
+                throw std::runtime_error("Corrupt graph snapshot: sorted node index out of range");
+            }
+            if (i > 0 && nodes[sorted_nodes[i]] < nodes[sorted_nodes[i - 1]]) {
+                throw std::runtime_error("Corrupt graph snapshot: node section is not sorted");
+            }
+        }
+    }
+
+    size_t get_order() const override {
+        return order;
+    }
+
+    size_t get_size() const override {
+        return edge_count;
+    }
+
+    void add_node(const Node&) override {
+        throw std::logic_error("SnapshotGraph is immutable");
+    }
+
+    void remove_node(const Node&) override {
+        throw std::logic_error("SnapshotGraph is immutable");
+    }
+
+    void add_edge(const Node&, const Node&) override {
+        throw std::logic_error("SnapshotGraph is immutable");
+    }
+
+    void add_edge(const Node&, const Node&, double) override {
+        throw std::logic_error("SnapshotGraph is immutable");
+    }
+
+    void remove_edge(const Node&, const Node&) override {
+        throw std::logic_error("SnapshotGraph is immutable");
+    }
+
+    std::vector<Node> get_neighbors(const Node& node) const override {
+        int index = get_index(node);
+        if (index == -1) {
+            return {};
+        }
+
+        std::vector<Node> result;
+        result.reserve(offsets[index + 1] - offsets[index]);
+        for (uint64_t k = offsets[index]; k < offsets[index + 1]; ++k) {
+            result.push_back(nodes[neighbors[k]]);
+        }
+        return result;
+    }
+
+    std::vector<Node> get_nodes() const override {
+        return std::vector<Node>(nodes, nodes + order);
+    }
+
+    bool has_node(const Node& node) const override {
+        return get_index(node) != -1;
+    }
+
+    /**
+     * @brief Imprime o grafo no mesmo formato utilizado pela CompressedSparseRowGraph.
+     */
+    void print() const override {
+        std::cout << "Graph (snapshot, " << (directed ? "directed" : "undirected")
+                  << ", order: " << get_order() << ", size: " << get_size() << "):\n";
+        for (size_t i = 0; i < order; ++i) {
+            std::cout << nodes[i] << ": ";
+            for (uint64_t k = offsets[i]; k < offsets[i + 1]; ++k) {
+                std::cout << nodes[neighbors[k]];
+                if (weights != nullptr) {
+                    std::cout << "(" << weights[k] << ")";
+                }
+                std::cout << " ";
+            }
+            std::cout << "\n";
+        }
+        std::cout << std::endl;
+    }
+
+    /*Busca binária na seção de nós ordenados, em O(log V)*/
+    int get_index(const Node& node) const override {
+        const int32_t* end = sorted_nodes + order;
+        const int32_t* it = std::lower_bound(sorted_nodes, end, node,
+            [this](int32_t index, const Node& value) { return nodes[index] < value; });
+        if (it != end && nodes[*it] == node) {
+            return *it;
+        }
+        return -1;
+    }
+
+    Node get_node(int index) const override {
+        check_index(index, "get_node: Index out of range");
+        return nodes[index];
+    }
+
+    std::vector<int> get_neighbors_indices(int index) const override {
+        check_index(index, "get_neighbors_indices: Index out of range");
+        return std::vector<int>(neighbors + offsets[index], neighbors + offsets[index + 1]);
+    }
+
+    bool for_each_neighbor(int index, NeighborVisitor visit) const override {
+        check_index(index, "for_each_neighbor: Index out of range");
+        for (uint64_t k = offsets[index]; k < offsets[index + 1]; ++k) {
+            if (!visit(neighbors[k])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool for_each_weighted_neighbor(int index, WeightedNeighborVisitor visit) const override {
+        check_index(index, "for_each_weighted_neighbor: Index out of range");
+        for (uint64_t k = offsets[index]; k < offsets[index + 1]; ++k) {
+            if (!visit(neighbors[k], weights == nullptr ? 1.0 : weights[k])) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    double get_weight(int from_index, int to_index) const override {
+        check_index(from_index, "get_weight: Index out of range");
+        for (uint64_t k = offsets[from_index]; k < offsets[from_index + 1]; ++k) {
+            if (neighbors[k] == to_index) {
+                return weights == nullptr ? 1.0 : weights[k];
+            }
+        }
+        return std::numeric_limits<double>::infinity();
+    }
+
+    /**
+     * @brief Indica se o snapshot armazena pesos para as arestas.
+     */
+    bool is_weighted() const {
+        return weights != nullptr;
+    }
+
+    size_t get_in_degree(const Node& node) const override {
+        int index = get_index(node);
+        return index == -1 ? 0 : in_degrees[index];
+    }
+
+    size_t get_out_degree(const Node& node) const override {
+        int index = get_index(node);
+        return index == -1 ? 0 : offsets[index + 1] - offsets[index];
+    }
+
+    bool is_adjacent(const Node& u, const Node& v) const override {
+        int u_index = get_index(u);
+        int v_index = get_index(v);
+        if (u_index == -1 || v_index == -1) {
+            return false;
+        }
+        const int32_t* begin = neighbors + offsets[u_index];
+        const int32_t* end = neighbors + offsets[u_index + 1];
+        return std::find(begin, end, v_index) != end;
+    }
+
+    std::vector<EdgeIndex> get_all_edges() const override {
+        std::vector<EdgeIndex> edges;
+        edges.reserve(directed ? offsets[order] : edge_count);
+        for (size_t from = 0; from < order; ++from) {
+            for (uint64_t k = offsets[from]; k < offsets[from + 1]; ++k) {
+                // Em grafos não-direcionados, cada aresta é devolvida apenas uma vez
+                if (directed || static_cast<int>(from) <= neighbors[k]) {
+                    edges.push_back(EdgeIndex{static_cast<int>(from), neighbors[k]});
+                }
+            }
+        }
+        return edges;
+    }
+
+    bool is_directed() const override {
+        return directed;
+    }
+};
+
+/**
+ * @brief Abre um snapshot gravado por save_graph_snapshot.
+ * @tparam Node O tipo de dado dos nós, o mesmo usado na gravação.
+ * @param filename O caminho do arquivo.
+ * @return O grafo servido diretamente do arquivo mapeado.
+ */
+template<typename Node>
+SnapshotGraph<Node> load_graph_snapshot(const std::string& filename) {
+    return SnapshotGraph<Node>(filename);
+}
+
+#endif // GRAPH_SNAPSHOT_H
@@ -0,0 +1,68 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <string>
+#include <stdexcept>
+#include <cstddef>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+/**
+ * @class MappedFile
+ * @brief Arquivo mapeado em memória somente para leitura (POSIX mmap).
+ *
+ * O conteúdo do arquivo é acessado diretamente pelas páginas do sistema operacional, sem
+ * cópias para buffers de leitura. O mapeamento é desfeito no destrutor.
+ */
+class MappedFile {
+    const char* bytes = nullptr;
+    size_t length = 0;
+
+public:
+    /**
+     * @brief Mapeia o arquivo inteiro em memória.
+     * @param filename O caminho para o arquivo.
+     * @throws std::runtime_error se o arquivo não puder ser aberto ou mapeado.
+     */
+    explicit MappedFile(const std::string& filename) {
+        int fd = ::open(filename.c_str(), O_RDONLY);
+        if (fd == -1) {
+            throw std::runtime_error("Could not open file: " + filename);
+        }
+        struct stat info;
+        if (::fstat(fd, &info) == -1) {
+            ::close(fd);
+            throw std::runtime_error("Could not read file size: " + filename);
+        }
+        length = static_cast<size_t>(info.st_size);
+        if (length > 0) {
+            void* mapped = ::mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (mapped == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Could not map file: " + filename);
+            }
+            // O arquivo é lido do início ao fim, então a leitura antecipada do kernel ajuda.
+            ::madvise(mapped, length, MADV_SEQUENTIAL);
+            bytes = static_cast<const char*>(mapped);
+        }
+        // O mapeamento continua válido depois que o descritor é fechado.
+        ::close(fd);
+    }
+
+    ~MappedFile() {
+        if (bytes != nullptr) {
+            ::munmap(const_cast<char*>(bytes), length);
+        }
+    }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    const char* data() const { return bytes; }
+    size_t size() const { return length; }
+};
+
+#endif // MAPPED_FILE_H
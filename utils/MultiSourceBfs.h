@@ -0,0 +1,143 @@
+#ifndef MULTI_SOURCE_BFS_H
+#define MULTI_SOURCE_BFS_H
+
+#include <vector>
+#include <stdexcept>
+#include <algorithm>
+#include <cstdint>
+
+#include "../graph/IGraph.h"
+
+/**
+ * @class MultiSourceBfs
+ * @brief Várias buscas em largura simultâneas, com uma máscara de bits por nó (MS-BFS, de Then
+ * et al.).
+ * @tparam Node O tipo de dado dos nós do grafo.
+ *
+ * @details As origens são processadas em lotes de até 64, e o bit k das máscaras corresponde à
+ * k-ésima origem do lote. Cada nó guarda três máscaras: 'seen', as buscas que já o alcançaram;
+ * 'visit', as buscas em que ele está na fronteira atual; e 'next', as buscas em que ele estará
+ * na próxima. A cada nível, os vizinhos de um nó da fronteira são percorridos uma única vez
+ * para todas as buscas do lote: o vizinho recebe visit & ~seen, ou seja, as buscas que o
+ * alcançam agora pela primeira vez.
+ *
+ * Quando as buscas se sobrepõem, como em grafos de diâmetro pequeno, um nó costuma estar na
+ * fronteira de muitas delas no mesmo nível, e o número de vezes que as listas de vizinhos são
+ * percorridas cai de até 64 para poucas por lote.
+ *
+ * Os níveis são os mesmos de bfs_tree para cada origem.
+ */
+template<typename Node>
+class MultiSourceBfs {
+    static constexpr size_t BATCH_SIZE = 64;
+
+    const IGraph<Node>& graph;
+    std::vector<uint64_t> seen, visit, next;
+
+    /**
+     * @brief Executa as buscas de um lote de até 64 origens.
+     * @param sources As origens do lote.
+     * @param levels Os vetores de níveis das origens do lote, já com -1 em todos os nós.
+     */
+    void run_batch(const int* sources, size_t count, std::vector<int>* levels) {
+        std::fill(seen.begin(), seen.end(), 0);
+
+        std::vector<int> frontier, next_frontier;
+        for (size_t k = 0; k < count; ++k) {
+            int source = sources[k];
+            uint64_t bit = uint64_t(1) << k;
+            if (visit[source] == 0) {
+                frontier.push_back(source);
+            }
+            seen[source] |= bit;
+            visit[source] |= bit;
+            levels[k][source] = 0;
+        }
+
+        for (int level = 1; !frontier.empty(); ++level) {
+            next_frontier.clear();
+            for (int current : frontier) {
+                uint64_t mask = visit[current];
+                graph.for_each_neighbor(current, [&](int neighbor_index) {
+                    /*Buscas do lote que alcançam o vizinho pela primeira vez*/
+                    uint64_t discovered = mask & ~seen[neighbor_index];
+                    if (discovered != 0) {
+                        if (next[neighbor_index] == 0) {
+                            next_frontier.push_back(neighbor_index);
+                        }
+                        next[neighbor_index] |= discovered;
+                        seen[neighbor_index] |= discovered;
+                    }
+                });
+            }
+
+            for (int current : frontier) {
+                visit[current] = 0;
+            }
+            for (int index : next_frontier) {
+                uint64_t mask = next[index];
+                visit[index] = mask;
+                next[index] = 0;
+                /*Registra o nível do nó em cada busca que o alcançou, um bit de cada vez*/
+                while (mask != 0) {
+                    levels[__builtin_ctzll(mask)][index] = level;
+                    mask &= mask - 1;
+                }
+            }
+            frontier.swap(next_frontier);
+        }
+    }
+
+public:
+    /**
+     * @brief Prepara as buscas em um grafo, que não pode ser modificado enquanto o objeto existir.
+     * @param graph O grafo no qual as buscas serão realizadas.
+     */
+    explicit MultiSourceBfs(const IGraph<Node>& graph)
+        : graph(graph), seen(graph.get_order(), 0), visit(graph.get_order(), 0), next(graph.get_order(), 0) {}
+
+    /**
+     * @brief Realiza uma busca a partir de cada origem.
+     * @param source_indices Os índices das origens; uma origem pode aparecer mais de uma vez.
+     * @return Um vetor de níveis por origem, na ordem das origens: levels[k][i] é a distância em
+     * arestas da k-ésima origem até o nó de índice i, ou -1 se ele não for alcançável.
+     * @throws std::out_of_range se algum índice for inválido.
+     */
+    std::vector<std::vector<int>> run(const std::vector<int>& source_indices) {
+        size_t order = graph.get_order();
+        for (int source : source_indices) {
+            if (source < 0 || static_cast<size_t>(source) >= order) {
+                throw std::out_of_range("multi_source_bfs: Index out of range");
+            }
+        }
+
+        std::vector<std::vector<int>> levels(source_indices.size(), std::vector<int>(order, -1));
+        for (size_t first = 0; first < source_indices.size(); first += BATCH_SIZE) {
+            size_t count = std::min(BATCH_SIZE, source_indices.size() - first);
+            run_batch(source_indices.data() + first, count, levels.data() + first);
+        }
+        return levels;
+    }
+};
+
+/**
+ * @brief Realiza uma busca em largura a partir de cada origem, 64 origens por vez.
+ *
+ * Equivale a chamar bfs_tree para cada origem e guardar os níveis, mas percorre as listas de
+ * vizinhos uma vez por lote e nível, em vez de uma vez por busca.
+ * @param graph O grafo no qual as buscas serão realizadas.
+ * @param sources Os nós de origem.
+ * @return Um vetor de níveis por origem, indexado pelos índices dos nós; -1 para nós não alcançáveis.
+ * @throws std::out_of_range se alguma origem não existir no grafo.
+ */
+template<typename Node>
+std::vector<std::vector<int>> multi_source_bfs(const IGraph<Node>& graph, const std::vector<Node>& sources) {
+    std::vector<int> source_indices;
+    source_indices.reserve(sources.size());
+    for (const Node& source : sources) {
+        source_indices.push_back(graph.get_index(source));
+    }
+    return MultiSourceBfs<Node>(graph).run(source_indices);
+}
+
+#endif // MULTI_SOURCE_BFS_H
@@ -0,0 +1,266 @@
+#ifndef PARALLEL_BFS_H
+#define PARALLEL_BFS_H
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <exception>
+#include <stdexcept>
+#include <algorithm>
+#include <iostream>
+#include <cstdint>
+
+#include "../graph/IGraph.h"
+#include "Bfs.h"
+
+/**
+ * @class ParallelBfs
+ * @brief BFS síncrona por níveis, com a fronteira de cada nível expandida por várias threads.
+ * @tparam Node O tipo de dado dos nós do grafo.
+ *
+ * @details Cada nível é dividido em blocos de nós que as threads retiram de um contador
+ * atômico, o que equilibra a carga mesmo quando poucos nós concentram a maior parte das
+ * arestas. Um nó é reivindicado marcando o seu bit em um mapa de bits atômico (fetch_or): só a
+ * thread que mudou o bit grava o nível e o pai do nó e o coloca na sua fila local, e as filas
+ * locais são concatenadas para formar a próxima fronteira. Fronteiras pequenas são expandidas
+ * pela própria thread que chamou a busca, sem o custo de criar threads, de modo que grafos de
+ * diâmetro grande não pagam uma criação de threads por nível.
+ *
+ * O mapa de bits é compartilhado entre as buscas feitas pelo mesmo objeto, o que permite
+ * percorrer todos os componentes do grafo com visit. O grafo não pode ser modificado durante
+ * a busca, e suas operações const precisam poder ser chamadas por várias threads ao mesmo
+ * tempo, como acontece com todas as representações do repositório.
+ *
+ * Os níveis são os mesmos de bfs_tree. Dentro de um nível, a ordem dos nós e a escolha do pai
+ * entre vários predecessores dependem do escalonamento das threads.
+ */
+template<typename Node>
+class ParallelBfs {
+    // Fronteiras menores que isso são expandidas sem criar threads.
+    static constexpr size_t PARALLEL_FRONTIER_MIN = 1024;
+    // Número de nós da fronteira retirados de uma vez por cada thread.
+    static constexpr size_t CHUNK_SIZE = 64;
+
+    const IGraph<Node>& graph;
+    unsigned thread_count;
+    std::unique_ptr<std::atomic<uint64_t>[]> visited;
+
+    /**
+     * @brief Marca um nó como visitado.
+     * @return true se esta chamada foi a que marcou o nó.
+     */
+    bool claim(int index) {
+        uint64_t bit = uint64_t(1) << (index & 63);
+        std::atomic<uint64_t>& word = visited[index >> 6];
+        if (word.load(std::memory_order_relaxed) & bit) {
+            return false;
+        }
+        return !(word.fetch_or(bit, std::memory_order_relaxed) & bit);
+    }
+
+    /**
+     * @brief Expande os nós frontier[begin, end) para a fila 'next'.
+     */
+    void expand(const std::vector<int>& frontier, size_t begin, size_t end, int level, BFSTree* tree,
+                std::vector<int>& next) {
+        for (size_t k = begin; k < end; ++k) {
+            int current = frontier[k];
+            graph.for_each_neighbor(current, [&](int neighbor_index) {
+                if (claim(neighbor_index)) {
+                    if (tree != nullptr) {
+                        tree->level[neighbor_index] = level;
+                        tree->parent[neighbor_index] = current;
+                    }
+                    next.push_back(neighbor_index);
+                }
+            });
+        }
+    }
+
+    /**
+     * @brief Expande uma fronteira grande com thread_count threads.
+     */
+    void expand_parallel(const std::vector<int>& frontier, int level, BFSTree* tree, std::vector<int>& next) {
+        std::atomic<size_t> cursor{0};
+        std::vector<std::vector<int>> local_next(thread_count);
+        std::vector<std::exception_ptr> errors(thread_count);
+
+        auto work = [&](unsigned thread_index) {
+            try {
+                for (;;) {
+                    size_t begin = cursor.fetch_add(CHUNK_SIZE, std::memory_order_relaxed);
+                    if (begin >= frontier.size()) {
+                        break;
+                    }
+                    expand(frontier, begin, std::min(begin + CHUNK_SIZE, frontier.size()), level, tree,
+                           local_next[thread_index]);
+                }
+            } catch (...) {
+                errors[thread_index] = std::current_exception();
+            }
+        };
+
+        std::vector<std::thread> workers;
+        workers.reserve(thread_count - 1);
+        for (unsigned t = 1; t < thread_count; ++t) {
+            workers.emplace_back(work, t);
+        }
+        work(0);
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        size_t total = 0;
+        for (const auto& part : local_next) {
+            total += part.size();
+        }
+        next.reserve(total);
+        for (const auto& part : local_next) {
+            next.insert(next.end(), part.begin(), part.end());
+        }
+    }
+
+public:
+    /**
+     * @brief Prepara as buscas em um grafo.
+     * @param graph O grafo no qual as buscas serão realizadas.
+     * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+     */
+    explicit ParallelBfs(const IGraph<Node>& graph, unsigned num_threads = 0)
+        : graph(graph),
+          thread_count(num_threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : num_threads) {
+        size_t words = (graph.get_order() + 63) / 64;
+        visited.reset(new std::atomic<uint64_t>[words]);
+        for (size_t w = 0; w < words; ++w) {
+            visited[w].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Indica se o nó de índice 'index' já foi visitado por alguma busca deste objeto.
+     */
+    bool is_visited(int index) const {
+        return visited[index >> 6].load(std::memory_order_relaxed) & (uint64_t(1) << (index & 63));
+    }
+
+    /**
+     * @brief Visita os nós alcançáveis a partir de um índice que ainda não foram visitados.
+     * @param start_index O índice do nó de partida, que não pode ter sido visitado.
+     * @param tree Se não for nulo, recebe o nível e o pai de cada nó visitado.
+     * @return Os índices visitados, nível por nível.
+     * @throws std::out_of_range se o índice for inválido.
+     */
+    std::vector<int> visit(int start_index, BFSTree* tree = nullptr) {
+        if (start_index < 0 || static_cast<size_t>(start_index) >= graph.get_order()) {
+            throw std::out_of_range("parallel_bfs: Index out of range");
+        }
+
+        std::vector<int> order;
+        if (!claim(start_index)) {
+            return order;
+        }
+        if (tree != nullptr) {
+            tree->level[start_index] = 0;
+        }
+        order.push_back(start_index);
+
+        std::vector<int> frontier{start_index};
+        std::vector<int> next;
+        for (int level = 1; !frontier.empty(); ++level) {
+            next.clear();
+            if (thread_count > 1 && frontier.size() >= PARALLEL_FRONTIER_MIN) {
+                expand_parallel(frontier, level, tree, next);
+            } else {
+                expand(frontier, 0, frontier.size(), level, tree, next);
+            }
+            order.insert(order.end(), next.begin(), next.end());
+            frontier.swap(next);
+        }
+        return order;
+    }
+};
+
+/**
+ * @brief Realiza uma BFS paralela a partir de um índice e devolve os pais e os níveis de cada nó.
+ * @param graph O grafo no qual a busca será realizada.
+ * @param start_index O índice do nó de partida.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return A árvore da busca, com os mesmos níveis de bfs_tree.
+ * @throws std::out_of_range se o índice for inválido.
+ */
+template<typename Node>
+BFSTree parallel_bfs_tree(const IGraph<Node>& graph, int start_index, unsigned num_threads = 0) {
+    BFSTree tree(graph.get_order());
+    ParallelBfs<Node>(graph, num_threads).visit(start_index, &tree);
+    return tree;
+}
+
+/**
+ * @brief Versão paralela de bfs: os nós alcançáveis a partir de 'start', nível por nível.
+ *
+ * Devolve o mesmo conjunto de nós de bfs, e cada nó aparece depois de todos os nós mais
+ * próximos da origem; dentro de um nível, a ordem pode variar entre execuções.
+ * @param graph O grafo no qual a busca será realizada.
+ * @param start O nó de onde a busca deve começar.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return Os nós visitados, ou um vetor vazio se o nó inicial não existir.
+ */
+template<typename Node>
+std::vector<Node> parallel_bfs(const IGraph<Node>& graph, Node start, unsigned num_threads = 0) {
+    if (!graph.has_node(start)) {
+        std::cerr << "Start node '" << start << "' does not exist in the graph.\n";
+        return {};
+    }
+
+    std::vector<Node> result;
+    for (int index : ParallelBfs<Node>(graph, num_threads).visit(graph.get_index(start))) {
+        result.push_back(graph.get_node(index));
+    }
+    return result;
+}
+
+/**
+ * @brief Versão paralela de bfs_digraph: percorre todo o grafo, um componente por vez.
+ * @param graph O grafo a ser completamente percorrido.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return Um vetor por componente, na mesma ordem de bfs_digraph; dentro de cada componente,
+ * os nós ficam nível por nível.
+ */
+template<typename Node>
+std::vector<std::vector<Node>> parallel_bfs_digraph(const IGraph<Node>& graph, unsigned num_threads = 0) {
+    std::vector<std::vector<Node>> result;
+    ParallelBfs<Node> search(graph, num_threads);
+
+    for (size_t i = 0; i < graph.get_order(); i++) {
+        if (!search.is_visited(i)) {
+            std::vector<Node> component;
+            for (int index : search.visit(i)) {
+                component.push_back(graph.get_node(index));
+            }
+            result.push_back(std::move(component));
+        }
+    }
+    return result;
+}
+
+/**
+ * @brief Versão paralela de is_connected para grafos não-direcionados.
+ * @param graph O grafo a ser verificado.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return true se todos os nós forem alcançáveis a partir do primeiro.
+ */
+template<typename Node>
+bool parallel_is_connected(const IGraph<Node>& graph, unsigned num_threads = 0) {
+    if (graph.get_order() <= 1) {
+        return true;
+    }
+    return ParallelBfs<Node>(graph, num_threads).visit(0).size() == graph.get_order();
+}
+
+#endif // PARALLEL_BFS_H
@@ -0,0 +1,333 @@
+#ifndef PIPELINED_LOADER_H
+#define PIPELINED_LOADER_H
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <thread>
+#include <chrono>
+#include <exception>
+#include <fstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <cmath>
+
+#include "EdgeListParser.h"
+#include "BoundedQueue.h"
+
+/**
+ * @struct LoadStats
+ * @brief Tempo ocupado e volume de trabalho de cada etapa de uma leitura de arquivo.
+ *
+ * Os tempos de cada etapa contam apenas o trabalho da etapa, sem a espera pelas filas; a etapa
+ * com maior tempo ocupado (dividido pelo número de threads, no caso da conversão) é a que
+ * limita a vazão da leitura.
+ */
+struct LoadStats {
+    size_t bytes_read = 0;      // Bytes lidos do arquivo.
+    size_t edges_parsed = 0;    // Arestas convertidas de texto.
+    size_t edges_built = 0;     // Arestas entregues ao grafo.
+    unsigned parser_threads = 0; // Threads da etapa de conversão (0 na leitura sequencial).
+    double read_seconds = 0.0;  // Tempo ocupado lendo o arquivo.
+    double parse_seconds = 0.0; // Soma do tempo ocupado das threads de conversão.
+    double build_seconds = 0.0; // Tempo ocupado inserindo as arestas no grafo.
+    double total_seconds = 0.0; // Tempo total da leitura.
+
+    /*Vazão da leitura do arquivo, em MB/s*/
+    double read_throughput() const {
+        return read_seconds > 0.0 ? bytes_read / read_seconds / 1e6 : 0.0;
+    }
+
+    /*Vazão da conversão, em arestas/s, considerando as threads em paralelo*/
+    double parse_throughput() const {
+        return parse_seconds > 0.0 ? edges_parsed * std::max(1u, parser_threads) / parse_seconds : 0.0;
+    }
+
+    /*Vazão da inserção no grafo, em arestas/s*/
+    double build_throughput() const {
+        return build_seconds > 0.0 ? edges_built / build_seconds : 0.0;
+    }
+
+    /**
+     * @brief Retorna o nome da etapa com maior tempo ocupado: "read", "parse" ou "build".
+     */
+    const char* bottleneck() const {
+        double parse_wall = parse_seconds / std::max(1u, parser_threads);
+        if (read_seconds >= parse_wall && read_seconds >= build_seconds) {
+            return "read";
+        }
+        return parse_wall >= build_seconds ? "parse" : "build";
+    }
+};
+
+/**
+ * @brief Imprime o tempo e a vazão de cada etapa de uma leitura.
+ */
+inline void print_load_stats(const LoadStats& stats) {
+    std::cout << std::fixed << std::setprecision(3);
+    std::cout << "Load stats (" << stats.parser_threads << " parser thread(s)):\n";
+    std::cout << "  read:  " << stats.bytes_read << " bytes in " << stats.read_seconds << " s ("
+              << stats.read_throughput() << " MB/s)\n";
+    std::cout << "  parse: " << stats.edges_parsed << " edges in " << stats.parse_seconds << " s ("
+              << stats.parse_throughput() / 1e6 << " M edges/s)\n";
+    std::cout << "  build: " << stats.edges_built << " edges in " << stats.build_seconds << " s ("
+              << stats.build_throughput() / 1e6 << " M edges/s)\n";
+    std::cout << "  total: " << stats.total_seconds << " s, bottleneck: " << stats.bottleneck() << "\n\n";
+    std::cout.unsetf(std::ios::floatfield);
+    std::cout << std::setprecision(6);
+}
+
+/**
+ * @struct PipelineOptions
+ * @brief Parâmetros da leitura em pipeline.
+ */
+struct PipelineOptions {
+    size_t block_bytes = 1 << 20;  // Tamanho de cada bloco lido do arquivo.
+    unsigned parser_threads = 1;   // Número de threads de conversão.
+    size_t queue_capacity = 4;     // Blocos em espera em cada fila entre as etapas.
+};
+
+/**
+ * @class EdgeListPipeline
+ * @brief Leitura de um arquivo de lista de arestas em três etapas concorrentes.
+ * @tparam Node O tipo de dado dos nós do grafo.
+ *
+ * Uma thread lê o arquivo em blocos terminados em quebra de linha; threads de conversão
+ * transformam cada bloco em um lote de arestas com parse_edge_chunk; e a thread que chama run
+ * entrega os lotes ao grafo. As etapas se comunicam por filas limitadas (BoundedQueue), então a
+ * memória usada é de alguns blocos por fila, independentemente do tamanho do arquivo, e
+ * enquanto o grafo recebe um lote os próximos já estão sendo lidos e convertidos.
+ *
+ * Os blocos são distribuídos entre as threads de conversão em rodízio, cada uma com suas
+ * próprias filas, e recolhidos na mesma ordem; assim os lotes chegam ao grafo na ordem do
+ * arquivo sem precisar de reordenação.
+ */
+template<typename Node>
+class EdgeListPipeline {
+    using Clock = std::chrono::steady_clock;
+
+    std::ifstream file;
+    PipelineOptions options;
+    size_t header_order = 0;
+
+    static double seconds_since(Clock::time_point start) {
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+public:
+    /**
+     * @brief Abre o arquivo e lê a linha de cabeçalho com a ordem do grafo.
+     * @param filename O caminho para o arquivo de entrada.
+     * @param options Os parâmetros da leitura.
+     * @throws std::runtime_error se o arquivo não puder ser aberto.
+     */
+    explicit EdgeListPipeline(const std::string& filename, const PipelineOptions& options = PipelineOptions())
+        : file(filename, std::ios::binary), options(options) {
+        if (!file.is_open()) {
+            throw std::runtime_error("Could not open file: " + filename);
+        }
+        this->options.block_bytes = std::max<size_t>(this->options.block_bytes, 64);
+        this->options.parser_threads = std::max(1u, this->options.parser_threads);
+
+        std::string line;
+        std::getline(file, line);
+        std::string_view header = trim_field(line);
+        std::from_chars(header.data(), header.data() + header.size(), header_order);
+    }
+
+    /**
+     * @brief Retorna a ordem informada no cabeçalho do arquivo.
+     */
+    size_t order() const {
+        return header_order;
+    }
+
+    /**
+     * @brief Executa a leitura, chamando consume com cada lote de arestas na ordem do arquivo.
+     *
+     * consume é chamado apenas na thread que chamou run. Se qualquer etapa lançar uma exceção,
+     * as demais são interrompidas e a exceção é relançada aqui.
+     * @param consume Função void(ParsedEdgeChunk<Node>&) que insere um lote no grafo.
+     * @param stats Se não for nulo, recebe o tempo e o volume de cada etapa.
+     */
+    template<typename Consume>
+    void run(Consume&& consume, LoadStats* stats = nullptr) {
+        Clock::time_point start = Clock::now();
+        unsigned parser_count = options.parser_threads;
+
+        std::vector<std::unique_ptr<BoundedQueue<std::vector<char>>>> raw_blocks;
+        std::vector<std::unique_ptr<BoundedQueue<ParsedEdgeChunk<Node>>>> parsed_batches;
+        for (unsigned i = 0; i < parser_count; ++i) {
+            raw_blocks.push_back(std::make_unique<BoundedQueue<std::vector<char>>>(options.queue_capacity));
+            parsed_batches.push_back(std::make_unique<BoundedQueue<ParsedEdgeChunk<Node>>>(options.queue_capacity));
+        }
+        auto close_all = [&]() {
+            for (unsigned i = 0; i < parser_count; ++i) {
+                raw_blocks[i]->close();
+                parsed_batches[i]->close();
+            }
+        };
+
+        LoadStats local;
+        local.parser_threads = parser_count;
+        std::exception_ptr reader_error;
+        std::vector<std::exception_ptr> parser_errors(parser_count);
+        std::vector<double> parse_seconds(parser_count, 0.0);
+        std::vector<size_t> edges_parsed(parser_count, 0);
+
+        /*Etapa de leitura: blocos com linhas completas, distribuídos em rodízio*/
+        std::thread reader([&]() {
+            try {
+                std::vector<char> carry;
+                size_t block_count = 0;
+                bool finished = false;
+                while (!finished) {
+                    std::vector<char> block(carry.size() + options.block_bytes);
+                    std::copy(carry.begin(), carry.end(), block.begin());
+
+                    Clock::time_point read_start = Clock::now();
+                    file.read(block.data() + carry.size(), static_cast<std::streamsize>(options.block_bytes));
+                    size_t read_bytes = static_cast<size_t>(file.gcount());
+                    local.read_seconds += seconds_since(read_start);
+                    local.bytes_read += read_bytes;
+
+                    size_t filled = carry.size() + read_bytes;
+                    size_t cut = filled;
+                    if (read_bytes < options.block_bytes) {
+                        // Fim do arquivo: a última linha pode não terminar com quebra de linha.
+                        finished = true;
+                    } else {
+                        while (cut > 0 && block[cut - 1] != '\n') {
+                            --cut;
+                        }
+                    }
+                    // Uma linha maior que o bloco fica inteira para o próximo, que será maior.
+                    carry.assign(block.begin() + cut, block.begin() + filled);
+                    block.resize(cut);
+                    if (!block.empty() && !raw_blocks[block_count++ % parser_count]->push(std::move(block))) {
+                        break;
+                    }
+                }
+            } catch (...) {
+                reader_error = std::current_exception();
+                close_all();
+            }
+            for (auto& queue : raw_blocks) {
+                queue->close();
+            }
+        });
+
+        /*Etapa de conversão: cada thread atende as suas próprias filas*/
+        std::vector<std::thread> parsers;
+        parsers.reserve(parser_count);
+        for (unsigned i = 0; i < parser_count; ++i) {
+            parsers.emplace_back([&, i]() {
+                try {
+                    std::vector<char> block;
+                    while (raw_blocks[i]->pop(block)) {
+                        Clock::time_point parse_start = Clock::now();
+                        ParsedEdgeChunk<Node> batch;
+                        parse_edge_chunk(block.data(), block.data() + block.size(), batch);
+                        parse_seconds[i] += seconds_since(parse_start);
+                        edges_parsed[i] += batch.sources.size();
+                        if (!parsed_batches[i]->push(std::move(batch))) {
+                            break;
+                        }
+                    }
+                } catch (...) {
+                    parser_errors[i] = std::current_exception();
+                    close_all();
+                }
+                parsed_batches[i]->close();
+            });
+        }
+
+        /*Etapa de construção: recolhe os lotes na mesma ordem em que os blocos foram distribuídos*/
+        std::exception_ptr build_error;
+        try {
+            ParsedEdgeChunk<Node> batch;
+            for (size_t batch_count = 0; parsed_batches[batch_count % parser_count]->pop(batch); ++batch_count) {
+                Clock::time_point build_start = Clock::now();
+                consume(batch);
+                local.build_seconds += seconds_since(build_start);
+                local.edges_built += batch.sources.size();
+            }
+        } catch (...) {
+            build_error = std::current_exception();
+            close_all();
+        }
+
+        reader.join();
+        for (std::thread& parser : parsers) {
+            parser.join();
+        }
+        if (build_error) {
+            std::rethrow_exception(build_error);
+        }
+        if (reader_error) {
+            std::rethrow_exception(reader_error);
+        }
+        for (const std::exception_ptr& error : parser_errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+
+        for (unsigned i = 0; i < parser_count; ++i) {
+            local.parse_seconds += parse_seconds[i];
+            local.edges_parsed += edges_parsed[i];
+        }
+        local.total_seconds = seconds_since(start);
+        if (stats != nullptr) {
+            *stats = local;
+        }
+    }
+};
+
+/**
+ * @brief Popula um grafo lendo o arquivo com EdgeListPipeline.
+ *
+ * As arestas são inseridas com add_edge na ordem do arquivo, então o resultado é o mesmo de
+ * populate_graph_from_file; os pesos, se existirem, são descartados.
+ * @param filename O caminho para o arquivo de entrada.
+ * @param graph O grafo a ser populado.
+ * @param options Os parâmetros da leitura.
+ * @param stats Se não for nulo, recebe o tempo e o volume de cada etapa.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
+template<typename Node>
+void populate_graph_pipelined(const std::string& filename, IGraph<Node>& graph,
+                              const PipelineOptions& options = PipelineOptions(), LoadStats* stats = nullptr) {
+    EdgeListPipeline<Node> pipeline(filename, options);
+    create_nodes(graph, static_cast<int>(pipeline.order()));
+    pipeline.run([&graph](ParsedEdgeChunk<Node>& batch) {
+        for (size_t k = 0; k < batch.sources.size(); ++k) {
+            graph.add_edge(batch.sources[k], batch.targets[k]);
+        }
+    }, stats);
+}
+
+/**
+ * @brief Popula um grafo ponderado lendo o arquivo "u,v,peso" com EdgeListPipeline.
+ *
+ * Equivale a populate_graph_weighted_from_file para IWeightedGraph, inclusive para linhas sem peso.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
+template<typename Node>
+void populate_graph_pipelined(const std::string& filename, IWeightedGraph<Node>& graph,
+                              const PipelineOptions& options = PipelineOptions(), LoadStats* stats = nullptr) {
+    EdgeListPipeline<Node> pipeline(filename, options);
+    create_nodes(graph, static_cast<int>(pipeline.order()));
+    pipeline.run([&graph](ParsedEdgeChunk<Node>& batch) {
+        for (size_t k = 0; k < batch.sources.size(); ++k) {
+            if (std::isnan(batch.weights[k])) {
+                graph.add_edge(batch.sources[k], batch.targets[k]);
+            } else {
+                graph.add_edge(batch.sources[k], batch.targets[k], batch.weights[k]);
+            }
+        }
+    }, stats);
+}
+
+#endif // PIPELINED_LOADER_H
@@ -0,0 +1,330 @@
+#ifndef RESULT_WRITER_H
+#define RESULT_WRITER_H
+
+#include <string>
+#include <string_view>
+#include <vector>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <stdexcept>
+#include <charconv>
+#include <cstdint>
+#include <type_traits>
+
+#include "../graph/IGraph.h"
+
+/**
+ * @brief Maior ordem de grafo para a qual as funções print_* imprimem tabelas.
+ *
+ * Acima dela, a tabela não cabe na tela e a formatação célula a célula com std::cout custa
+ * mais que o próprio algoritmo; use as funções write_* para exportar o resultado.
+ */
+inline constexpr size_t PRETTY_PRINT_MAX_ORDER = 64;
+
+/**
+ * @brief Verifica se um resultado é grande demais para ser impresso como tabela.
+ *
+ * Se for, imprime apenas uma linha avisando que a tabela foi omitida.
+ * @param title O título da tabela.
+ * @param order A ordem do grafo.
+ * @return true se a impressão deve ser omitida.
+ */
+inline bool skip_pretty_print(const char* title, size_t order) {
+    if (order <= PRETTY_PRINT_MAX_ORDER) {
+        return false;
+    }
+    std::cout << title << ": " << order << " nodes, too large to print (use the write_* exporters)\n\n";
+    return true;
+}
+
+/**
+ * @enum ResultFormat
+ * @brief Formatos de exportação de resultados.
+ *
+ * CSV e TSV têm uma linha de cabeçalho e usam os valores dos nós como rótulos; distâncias
+ * infinitas são escritas como "inf" e predecessores ausentes ficam vazios. BINARY escreve
+ * os valores brutos na ordem dos índices internos (o índice i corresponde a graph.get_node(i)),
+ * precedidos pelas dimensões em uint64, na ordem de bytes da máquina.
+ */
+enum class ResultFormat { CSV, TSV, BINARY };
+
+/**
+ * @class ResultBuffer
+ * @brief Acumula a saída em um buffer grande e a escreve no stream em blocos.
+ *
+ * Os números são convertidos com std::to_chars, sem manipuladores de iostream nem descarga
+ * do stream a cada linha.
+ */
+class ResultBuffer {
+    std::ostream& out;
+    std::string buffer;
+    size_t capacity;
+
+public:
+    explicit ResultBuffer(std::ostream& out, size_t capacity = 1 << 20) : out(out), capacity(capacity) {
+        buffer.reserve(capacity);
+    }
+
+    ResultBuffer(const ResultBuffer&) = delete;
+    ResultBuffer& operator=(const ResultBuffer&) = delete;
+
+    ~ResultBuffer() {
+        flush();
+    }
+
+    /*Escreve o conteúdo acumulado no stream*/
+    void flush() {
+        if (!buffer.empty()) {
+            out.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            buffer.clear();
+        }
+    }
+
+    void put(char c) {
+        if (buffer.size() + 1 > capacity) flush();
+        buffer.push_back(c);
+    }
+
+    void append(std::string_view text) {
+        if (buffer.size() + text.size() > capacity) flush();
+        buffer.append(text.data(), text.size());
+    }
+
+    /*Escreve um número em texto; double usa a menor representação que preserva o valor*/
+    template<typename T>
+    void append_number(T value) {
+        char digits[32];
+        auto result = std::to_chars(digits, digits + sizeof(digits), value);
+        append(std::string_view(digits, static_cast<size_t>(result.ptr - digits)));
+    }
+
+    /*Escreve a representação binária de um valor*/
+    template<typename T>
+    void append_raw(const T& value) {
+        static_assert(std::is_trivially_copyable_v<T>, "append_raw: value must be trivially copyable");
+        append(std::string_view(reinterpret_cast<const char*>(&value), sizeof(T)));
+    }
+
+    template<typename T>
+    void append_raw(const std::vector<T>& values) {
+        static_assert(std::is_trivially_copyable_v<T>, "append_raw: values must be trivially copyable");
+        flush();
+        out.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(values.size() * sizeof(T)));
+    }
+
+    /*Escreve o valor de um nó como rótulo de CSV/TSV*/
+    template<typename Node>
+    void append_node(const Node& node, char separator) {
+        if constexpr (std::is_same_v<Node, char>) {
+            put(node);
+        } else if constexpr (std::is_arithmetic_v<Node> && !std::is_same_v<Node, bool>) {
+            append_number(node);
+        } else {
+            std::ostringstream text;
+            text << node;
+            append_field(text.str(), separator);
+        }
+    }
+
+    /*Escreve um campo de texto, entre aspas se contiver o separador, aspas ou quebra de linha*/
+    void append_field(std::string_view field, char separator) {
+        if (field.find_first_of(std::string{separator, '"', '\n'}) == std::string_view::npos) {
+            append(field);
+            return;
+        }
+        put('"');
+        for (char c : field) {
+            if (c == '"') put('"');
+            put(c);
+        }
+        put('"');
+    }
+};
+
+/**
+ * @brief Retorna o separador de colunas de um formato de texto.
+ */
+inline char result_separator(ResultFormat format) {
+    return format == ResultFormat::TSV ? '\t' : ',';
+}
+
+/**
+ * @brief Abre um arquivo de saída para as funções write_*.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
+inline std::ofstream open_result_file(const std::string& filename) {
+    std::ofstream file(filename, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        throw std::runtime_error("Could not open file: " + filename);
+    }
+    return file;
+}
+
+/**
+ * @brief Escreve a linha de cabeçalho com os rótulos das colunas de uma matriz.
+ */
+template<typename Node>
+void write_matrix_header(ResultBuffer& buffer, const IGraph<Node>& graph, char separator) {
+    buffer.append("node");
+    for (size_t j = 0; j < graph.get_order(); ++j) {
+        buffer.put(separator);
+        buffer.append_node(graph.get_node(static_cast<int>(j)), separator);
+    }
+    buffer.put('\n');
+}
+
+/**
+ * @brief Exporta uma matriz de distâncias (ou de pesos) entre todos os pares de nós.
+ *
+ * Em BINARY: linhas e colunas (uint64), seguidas das distâncias em double, linha a linha.
+ * @param distances A matriz de distâncias, indexada pelos índices internos do grafo.
+ * @param graph O grafo a que a matriz se refere.
+ * @param out O stream de saída.
+ * @param format O formato de exportação.
+ */
+template<typename Node>
+void write_distances_matrix(const std::vector<std::vector<double>>& distances, const IGraph<Node>& graph,
+                            std::ostream& out, ResultFormat format = ResultFormat::CSV) {
+    ResultBuffer buffer(out);
+    size_t order = graph.get_order();
+
+    if (format == ResultFormat::BINARY) {
+        buffer.append_raw(static_cast<uint64_t>(order));
+        buffer.append_raw(static_cast<uint64_t>(order));
+        for (size_t i = 0; i < order; ++i) {
+            buffer.append_raw(distances[i]);
+        }
+        return;
+    }
+
+    char separator = result_separator(format);
+    write_matrix_header(buffer, graph, separator);
+    for (size_t i = 0; i < order; ++i) {
+        buffer.append_node(graph.get_node(static_cast<int>(i)), separator);
+        for (size_t j = 0; j < order; ++j) {
+            buffer.put(separator);
+            buffer.append_number(distances[i][j]);
+        }
+        buffer.put('\n');
+    }
+}
+
+/**
+ * @brief Exporta uma matriz de distâncias para um arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
+template<typename Node>
+void write_distances_matrix(const std::vector<std::vector<double>>& distances, const IGraph<Node>& graph,
+                            const std::string& filename, ResultFormat format = ResultFormat::CSV) {
+    std::ofstream file = open_result_file(filename);
+    write_distances_matrix(distances, graph, file, format);
+}
+
+/**
+ * @brief Exporta uma matriz de predecessores entre todos os pares de nós.
+ *
+ * Em CSV e TSV, cada célula tem o nó predecessor, ou fica vazia se não houver caminho. Em
+ * BINARY: linhas e colunas (uint64), seguidas dos índices dos predecessores em int32, linha a
+ * linha, com -1 onde não há predecessor.
+ * @param predecessors A matriz de predecessores, indexada pelos índices internos do grafo.
+ * @param graph O grafo a que a matriz se refere.
+ * @param out O stream de saída.
+ * @param format O formato de exportação.
+ */
+template<typename Node>
+void write_predecessors_matrix(const std::vector<std::vector<int>>& predecessors, const IGraph<Node>& graph,
+                               std::ostream& out, ResultFormat format = ResultFormat::CSV) {
+    ResultBuffer buffer(out);
+    size_t order = graph.get_order();
+
+    if (format == ResultFormat::BINARY) {
+        buffer.append_raw(static_cast<uint64_t>(order));
+        buffer.append_raw(static_cast<uint64_t>(order));
+        for (size_t i = 0; i < order; ++i) {
+            buffer.append_raw(predecessors[i]);
+        }
+        return;
+    }
+
+    char separator = result_separator(format);
+    write_matrix_header(buffer, graph, separator);
+    for (size_t i = 0; i < order; ++i) {
+        buffer.append_node(graph.get_node(static_cast<int>(i)), separator);
+        for (size_t j = 0; j < order; ++j) {
+            buffer.put(separator);
+            if (predecessors[i][j] != -1) {
+                buffer.append_node(graph.get_node(predecessors[i][j]), separator);
+            }
+        }
+        buffer.put('\n');
+    }
+}
+
+/**
+ * @brief Exporta uma matriz de predecessores para um arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
+template<typename Node>
+void write_predecessors_matrix(const std::vector<std::vector<int>>& predecessors, const IGraph<Node>& graph,
+                               const std::string& filename, ResultFormat format = ResultFormat::CSV) {
+    std::ofstream file = open_result_file(filename);
+    write_predecessors_matrix(predecessors, graph, file, format);
+}
+
+/**
+ * @brief Exporta o resultado de um algoritmo de caminhos mínimos a partir de uma origem
+ * (Djikstra, Bellman-Ford).
+ *
+ * Em CSV e TSV, uma linha "nó,distância,predecessor" por nó. Em BINARY: a ordem (uint64),
+ * as distâncias em double e os índices dos predecessores em int32, com -1 onde não há predecessor.
+ * @param distances As distâncias da origem a cada nó.
+ * @param predecessors O predecessor de cada nó no caminho mínimo.
+ * @param graph O grafo onde o algoritmo foi aplicado.
+ * @param out O stream de saída.
+ * @param format O formato de exportação.
+ */
+template<typename Node>
+void write_shortest_paths(const std::vector<double>& distances, const std::vector<int>& predecessors,
+                          const IGraph<Node>& graph, std::ostream& out, ResultFormat format = ResultFormat::CSV) {
+    ResultBuffer buffer(out);
+    size_t order = graph.get_order();
+
+    if (format == ResultFormat::BINARY) {
+        buffer.append_raw(static_cast<uint64_t>(order));
+        buffer.append_raw(distances);
+        buffer.append_raw(predecessors);
+        return;
+    }
+
+    char separator = result_separator(format);
+    buffer.append("node");
+    buffer.put(separator);
+    buffer.append("distance");
+    buffer.put(separator);
+    buffer.append("predecessor\n");
+    for (size_t i = 0; i < order; ++i) {
+        buffer.append_node(graph.get_node(static_cast<int>(i)), separator);
+        buffer.put(separator);
+        buffer.append_number(distances[i]);
+        buffer.put(separator);
+        if (predecessors[i] != -1) {
+            buffer.append_node(graph.get_node(predecessors[i]), separator);
+        }
+        buffer.put('\n');
+    }
+}
+
+/**
+ * @brief Exporta o resultado de um algoritmo de caminhos mínimos para um arquivo.
+ * @throws std::runtime_error se o arquivo não puder ser aberto.
+ */
+template<typename Node>
+void write_shortest_paths(const std::vector<double>& distances, const std::vector<int>& predecessors,
+                          const IGraph<Node>& graph, const std::string& filename,
+                          ResultFormat format = ResultFormat::CSV) {
+    std::ofstream file = open_result_file(filename);
+    write_shortest_paths(distances, predecessors, graph, file, format);
+}
+
+#endif // RESULT_WRITER_H
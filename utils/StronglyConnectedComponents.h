@@ -0,0 +1,655 @@
+#ifndef STRONGLY_CONNECTED_COMPONENTS_H
+#define STRONGLY_CONNECTED_COMPONENTS_H
+
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <memory>
+#include <exception>
+#include <algorithm>
+#include <cstdint>
+
+#include "../graph/IGraph.h"
+#include "../graph/GraphBuilder.h"
+#include "../graph/CompressedSparseRowGraph.h"
+#include "Components.h"
+#include "Dfs.h"
+
+/**
+ * @struct TarjanState
+ * @brief Estado do algoritmo de Tarjan, compartilhado entre as buscas a partir de várias raízes.
+ */
+struct TarjanState {
+    std::vector<int> discovery, low;
+    std::vector<char> done;   // Se a componente do nó já foi concluída.
+    std::vector<int> pending; // Nós visitados cuja componente ainda não foi concluída.
+    DFSStack stack;
+    int time = 0;
+
+    explicit TarjanState(size_t order) : discovery(order, 0), low(order, 0), done(order, 0) {}
+};
+
+/**
+ * @brief Busca de Tarjan a partir de uma raiz, sem recursão.
+ *
+ * @details A DFS usa a mesma pilha explícita de dfs_visit (DFSStack), então grafos com caminhos
+ * longos não esgotam a pilha de chamadas. Uma componente é concluída quando o seu primeiro nó
+ * sai da DFS, o que acontece depois de concluídas todas as componentes que ela alcança.
+ * @param root O índice da raiz, que ainda não pode ter sido visitado.
+ * @param include Só os nós com include(índice) verdadeiro são percorridos.
+ * @param emit Chamada com o intervalo [begin, end) dos nós de cada componente concluída.
+ */
+template<typename Node, class Include, class Emit>
+void tarjan_visit(const IGraph<Node>& graph, int root, TarjanState& state, Include&& include, Emit&& emit) {
+    DFSStack& stack = state.stack;
+
+    auto enter = [&](int index) {
+        state.discovery[index] = state.low[index] = ++state.time;
+        state.pending.push_back(index);
+        size_t begin = stack.neighbors.size();
+        graph.for_each_neighbor(index, [&](int neighbor_index) {
+            if (include(neighbor_index)) {
+                stack.neighbors.push_back(neighbor_index);
+            }
+        });
+        stack.frames.push_back({index, begin, stack.neighbors.size()});
+    };
+
+    enter(root);
+    while (!stack.frames.empty()) {
+        DFSStack::Frame& frame = stack.frames.back();
+
+        if (frame.cursor != frame.end) {
+            int current = frame.node;
+            int neighbor_index = stack.neighbors[frame.cursor++];
+            if (state.discovery[neighbor_index] == 0) {
+                enter(neighbor_index); // Invalida 'frame'.
+            } else if (!state.done[neighbor_index]) {
+                /*O vizinho ainda está em 'pending', então pertence a uma componente em aberto*/
+                state.low[current] = std::min(state.low[current], state.discovery[neighbor_index]);
+            }
+            continue;
+        }
+
+        int current = frame.node;
+        stack.frames.pop_back();
+        stack.neighbors.resize(stack.frames.empty() ? 0 : stack.frames.back().end);
+
+        /*'current' é o primeiro nó da sua componente: ela é formada pelos nós acima dele em 'pending'*/
+        if (state.low[current] == state.discovery[current]) {
+            auto first = std::find(state.pending.rbegin(), state.pending.rend(), current).base() - 1;
+            for (auto it = first; it != state.pending.end(); ++it) {
+                state.done[*it] = 1;
+            }
+            emit(first, state.pending.end());
+            state.pending.erase(first, state.pending.end());
+        }
+        if (!stack.frames.empty()) {
+            int parent = stack.frames.back().node;
+            state.low[parent] = std::min(state.low[parent], state.low[current]);
+        }
+    }
+}
+
+/**
+ * @brief Calcula as componentes fortemente conexas com o algoritmo de Tarjan, sem recursão.
+ *
+ * Os identificadores seguem uma ordem topológica do grafo condensado: todo arco entre
+ * componentes vai de um identificador menor para um maior. Em grafos não-direcionados, as
+ * componentes são os componentes conexos.
+ * @param graph O grafo a ser analisado.
+ * @return O identificador da componente de cada nó e o tamanho de cada componente.
+ */
+template<typename Node>
+ComponentLabels tarjan_scc(const IGraph<Node>& graph) {
+    size_t order = graph.get_order();
+    TarjanState state(order);
+    std::vector<int> finished(order); // Ordem de conclusão da componente de cada nó.
+    std::vector<size_t> finished_sizes;
+
+    auto include = [](int) { return true; };
+    auto emit = [&](auto begin, auto end) {
+        for (auto it = begin; it != end; ++it) {
+            finished[*it] = static_cast<int>(finished_sizes.size());
+        }
+        finished_sizes.push_back(static_cast<size_t>(end - begin));
+    };
+    for (size_t root = 0; root < order; root++) {
+        if (state.discovery[root] == 0) {
+            tarjan_visit(graph, root, state, include, emit);
+        }
+    }
+
+    /*As componentes são concluídas em ordem topológica inversa*/
+    ComponentLabels result;
+    int count = static_cast<int>(finished_sizes.size());
+    result.component.resize(order);
+    for (size_t i = 0; i < order; i++) {
+        result.component[i] = count - 1 - finished[i];
+    }
+    result.sizes.assign(finished_sizes.rbegin(), finished_sizes.rend());
+    return result;
+}
+
+/**
+ * @class ParallelSCC
+ * @brief Componentes fortemente conexas calculadas por várias threads, com poda, uma busca
+ * forward-backward e coloração (Multistep, de Slota, Rajamanickam e Madduri).
+ * @tparam Node O tipo de dado dos nós do grafo.
+ *
+ * @details Os nós ainda sem componente formam o subgrafo ativo, que é sempre uma união de
+ * componentes inteiras. As etapas abaixo retiram componentes dele:
+ *
+ * 1. Poda: um nó sem vizinhos de entrada ou de saída ativos é, sozinho, uma componente. Cada
+ * nó guarda quantos vizinhos ativos tem em cada sentido, e retirar um nó decrementa os
+ * contadores dos vizinhos, então a poda completa custa O(V + E), como a ordenação de Kahn.
+ * 2. Forward-backward: a componente de um pivô de grau alto é a interseção dos nós que ele
+ * alcança com os que o alcançam. Em grafos reais, ela é a componente gigante, obtida com duas
+ * BFS em paralelo.
+ * 3. Coloração: cada nó recebe como cor o maior índice entre os nós que o alcançam,
+ * propagado pelos arcos até estabilizar. Cada nó cuja cor é o próprio índice é a raiz de uma
+ * componente, formada pelos nós da sua cor que a alcançam.
+ * 4. Quando restam poucos nós, ou quando uma rodada de coloração não estabiliza em poucas
+ * passadas ou retira poucos nós (o que acontece em cadeias longas de componentes pequenas),
+ * o restante é resolvido por tarjan_visit restrito aos nós ativos.
+ *
+ * As etapas 1 a 3 percorrem os nós ou a fronteira em blocos distribuídos entre as threads, e
+ * cada nó é atribuído a uma componente por compare_exchange. Os vizinhos de entrada vêm do
+ * grafo quando ele tem has_in_neighbor_access; caso contrário, são montados no construtor em
+ * formato CSR. O grafo não pode ser modificado durante a busca, e suas operações const
+ * precisam poder ser chamadas por várias threads ao mesmo tempo.
+ *
+ * As componentes são as mesmas de tarjan_scc, mas numeradas na ordem do menor índice de cada uma.
+ */
+template<typename Node>
+class ParallelSCC {
+    // Número de nós retirados de uma vez por cada thread.
+    static constexpr size_t CHUNK_SIZE = 1024;
+    // Com menos nós ativos que isso, o restante é resolvido por Tarjan.
+    static constexpr size_t SERIAL_CUTOFF = 1 << 14;
+    // Uma rodada de coloração que retira menos que 1 / COLORING_MIN_PROGRESS dos nós ativos
+    // indica uma cadeia de componentes pequenas, e o restante também é resolvido por Tarjan.
+    static constexpr size_t COLORING_MIN_PROGRESS = 16;
+    // Passadas de propagação de cores antes de desistir da coloração.
+    static constexpr int MAX_COLORING_SWEEPS = 64;
+
+    const IGraph<Node>& graph;
+    unsigned thread_count;
+    size_t order;
+
+    std::vector<int64_t> out_degree;
+    std::vector<int64_t> in_degree;
+
+    // Arcos de entrada em CSR, usados quando o grafo não tem has_in_neighbor_access.
+    bool own_in_arcs = false;
+    std::vector<size_t> in_offsets;
+    std::vector<int> in_sources;
+
+    // Componente de cada nó (-1 enquanto ativo) e cor da coloração.
+    std::unique_ptr<std::atomic<int>[]> component;
+    std::unique_ptr<std::atomic<int>[]> color;
+    // Vizinhos ativos de entrada e de saída de cada nó, usados pela poda.
+    std::unique_ptr<std::atomic<int>[]> active_in;
+    std::unique_ptr<std::atomic<int>[]> active_out;
+    // Nós alcançados pelo pivô, e nós já na próxima fronteira da coloração.
+    std::unique_ptr<std::atomic<uint8_t>[]> marks;
+    std::atomic<int> next_id{0};
+    std::vector<int> active;
+
+    static constexpr uint8_t FORWARD_MARK = 1;
+
+    bool is_active(int index) const {
+        return component[index].load(std::memory_order_relaxed) == -1;
+    }
+
+    /**
+     * @brief Visita os vizinhos de entrada de um nó até que visit retorne false.
+     */
+    template<typename Visit>
+    void visit_in_neighbors(int index, Visit&& visit) const {
+        if (own_in_arcs) {
+            for (size_t k = in_offsets[index]; k < in_offsets[index + 1]; ++k) {
+                if (!visit(in_sources[k])) {
+                    return;
+                }
+            }
+        } else {
+            graph.for_each_in_neighbor(index, [&visit](int source_index) {
+                return visit(source_index);
+            });
+        }
+    }
+
+    /**
+     * @brief Chama body(worker, begin, end) para blocos de [0, count), distribuídos entre as threads.
+     * @return O número de threads usadas.
+     */
+    template<class Body>
+    unsigned for_each_chunk(size_t count, Body&& body) const {
+        std::atomic<size_t> cursor{0};
+        auto work = [&](unsigned worker) {
+            for (;;) {
+                size_t begin = cursor.fetch_add(CHUNK_SIZE, std::memory_order_relaxed);
+                if (begin >= count) {
+                    break;
+                }
+                body(worker, begin, std::min(begin + CHUNK_SIZE, count));
+            }
+        };
+
+        unsigned workers_count = static_cast<unsigned>(
+            std::max<size_t>(1, std::min<size_t>(thread_count, (count + CHUNK_SIZE - 1) / CHUNK_SIZE)));
+        if (workers_count == 1) {
+            work(0);
+            return 1;
+        }
+
+        std::vector<std::exception_ptr> errors(workers_count);
+        std::vector<std::thread> workers;
+        workers.reserve(workers_count - 1);
+        for (unsigned t = 1; t < workers_count; ++t) {
+            workers.emplace_back([&, t]() {
+                try {
+                    work(t);
+                } catch (...) {
+                    errors[t] = std::current_exception();
+                }
+            });
+        }
+        try {
+            work(0);
+        } catch (...) {
+            errors[0] = std::current_exception();
+        }
+        for (std::thread& worker : workers) {
+            worker.join();
+        }
+        for (const std::exception_ptr& error : errors) {
+            if (error) {
+                std::rethrow_exception(error);
+            }
+        }
+        return workers_count;
+    }
+
+    /**
+     * @brief Expande uma fronteira: step(node, next) coloca em 'next' os nós alcançados a partir de node.
+     * @return A próxima fronteira.
+     */
+    template<class Step>
+    std::vector<int> expand(const std::vector<int>& frontier, Step&& step) const {
+        /*Fronteiras de um único bloco são expandidas pela thread atual, sem vetores por thread*/
+        if (thread_count == 1 || frontier.size() <= CHUNK_SIZE) {
+            std::vector<int> next;
+            for (int index : frontier) {
+                step(index, next);
+            }
+            return next;
+        }
+
+        std::vector<std::vector<int>> local_next(thread_count);
+        unsigned used = for_each_chunk(frontier.size(), [&](unsigned worker, size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                step(frontier[k], local_next[worker]);
+            }
+        });
+
+        if (used == 1) {
+            return std::move(local_next[0]);
+        }
+        std::vector<int> next;
+        for (unsigned t = 0; t < used; ++t) {
+            next.insert(next.end(), local_next[t].begin(), local_next[t].end());
+        }
+        return next;
+    }
+
+    /**
+     * @brief Remove de 'active' os nós que já receberam uma componente.
+     */
+    void compact_active() {
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [this](int index) { return !is_active(index); }),
+                     active.end());
+    }
+
+    /**
+     * @brief Atribui uma nova componente a um nó ativo.
+     * @return false se outra thread atribuiu uma componente antes.
+     */
+    bool claim(int index) {
+        int expected = -1;
+        return component[index].compare_exchange_strong(expected, next_id.fetch_add(1, std::memory_order_relaxed));
+    }
+
+    /**
+     * @brief Retira como componentes unitárias os nós sem vizinhos ativos de entrada ou de saída,
+     * até que não reste nenhum.
+     */
+    void trim() {
+        /*Conta os vizinhos ativos de cada nó, ignorando laços*/
+        for_each_chunk(active.size(), [&](unsigned, size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                int index = active[k];
+                int out_count = 0, in_count = 0;
+                graph.for_each_neighbor(index, [&](int neighbor_index) {
+                    out_count += neighbor_index != index && is_active(neighbor_index);
+                });
+                visit_in_neighbors(index, [&](int source_index) {
+                    in_count += source_index != index && is_active(source_index);
+                    return true;
+                });
+                active_out[index].store(out_count, std::memory_order_relaxed);
+                active_in[index].store(in_count, std::memory_order_relaxed);
+            }
+        });
+
+        std::vector<int> frontier = expand(active, [&](int index, std::vector<int>& next) {
+            if ((active_out[index].load(std::memory_order_relaxed) == 0
+                 || active_in[index].load(std::memory_order_relaxed) == 0) && claim(index)) {
+                next.push_back(index);
+            }
+        });
+
+        /*Retirar um nó pode zerar os contadores dos seus vizinhos*/
+        while (!frontier.empty()) {
+            frontier = expand(frontier, [&](int index, std::vector<int>& next) {
+                graph.for_each_neighbor(index, [&](int neighbor_index) {
+                    if (neighbor_index != index && is_active(neighbor_index)
+                        && active_in[neighbor_index].fetch_sub(1, std::memory_order_relaxed) == 1
+                        && claim(neighbor_index)) {
+                        next.push_back(neighbor_index);
+                    }
+                });
+                visit_in_neighbors(index, [&](int source_index) {
+                    if (source_index != index && is_active(source_index)
+                        && active_out[source_index].fetch_sub(1, std::memory_order_relaxed) == 1
+                        && claim(source_index)) {
+                        next.push_back(source_index);
+                    }
+                    return true;
+                });
+            });
+        }
+        compact_active();
+    }
+
+    /**
+     * @brief Retira a componente de um pivô de grau alto com uma BFS para frente e outra para trás.
+     */
+    void forward_backward() {
+        int pivot = *std::max_element(active.begin(), active.end(), [this](int a, int b) {
+            return out_degree[a] * in_degree[a] < out_degree[b] * in_degree[b];
+        });
+
+        /*Nós alcançados a partir do pivô*/
+        marks[pivot].store(FORWARD_MARK, std::memory_order_relaxed);
+        std::vector<int> frontier{pivot};
+        while (!frontier.empty()) {
+            frontier = expand(frontier, [&](int current, std::vector<int>& next) {
+                graph.for_each_neighbor(current, [&](int neighbor_index) {
+                    if (is_active(neighbor_index)
+                        && !(marks[neighbor_index].fetch_or(FORWARD_MARK, std::memory_order_relaxed) & FORWARD_MARK)) {
+                        next.push_back(neighbor_index);
+                    }
+                });
+            });
+        }
+
+        /*Entre eles, os que alcançam o pivô: todo caminho até o pivô só passa por nós alcançados por ele*/
+        int id = next_id.fetch_add(1, std::memory_order_relaxed);
+        component[pivot].store(id, std::memory_order_relaxed);
+        frontier.assign(1, pivot);
+        while (!frontier.empty()) {
+            frontier = expand(frontier, [&](int current, std::vector<int>& next) {
+                visit_in_neighbors(current, [&](int source_index) {
+                    int expected = -1;
+                    if ((marks[source_index].load(std::memory_order_relaxed) & FORWARD_MARK)
+                        && component[source_index].compare_exchange_strong(expected, id)) {
+                        next.push_back(source_index);
+                    }
+                    return true;
+                });
+            });
+        }
+
+        for_each_chunk(active.size(), [&](unsigned, size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                marks[active[k]].store(0, std::memory_order_relaxed);
+            }
+        });
+        compact_active();
+    }
+
+    /**
+     * @brief Uma rodada de coloração: retira a componente de cada nó cuja cor é o próprio índice.
+     * @return false se as cores não estabilizaram em MAX_COLORING_SWEEPS passadas; nesse caso,
+     * nenhuma componente é retirada.
+     */
+    bool coloring_round() {
+        for_each_chunk(active.size(), [&](unsigned, size_t begin, size_t end) {
+            for (size_t k = begin; k < end; ++k) {
+                color[active[k]].store(active[k], std::memory_order_relaxed);
+            }
+        });
+
+        /*Propaga a maior cor pelos arcos; a cada passada, só os nós cuja cor mudou são revisitados*/
+        std::vector<int> frontier = active;
+        for (int sweep = 0; !frontier.empty(); ++sweep) {
+            if (sweep == MAX_COLORING_SWEEPS) {
+                for (int index : frontier) {
+                    marks[index].store(0, std::memory_order_relaxed);
+                }
+                return false;
+            }
+            frontier = expand(frontier, [&](int index, std::vector<int>& next) {
+                /*Ordem sequencial: quem aumentar a cor depois desta leitura vê a marca limpa e reinsere o nó*/
+                marks[index].store(0);
+                int current_color = color[index].load();
+                graph.for_each_neighbor(index, [&](int neighbor_index) {
+                    if (!is_active(neighbor_index)) {
+                        return;
+                    }
+                    int neighbor_color = color[neighbor_index].load(std::memory_order_relaxed);
+                    while (neighbor_color < current_color) {
+                        if (color[neighbor_index].compare_exchange_weak(neighbor_color, current_color)) {
+                            if (!marks[neighbor_index].exchange(FORWARD_MARK)) {
+                                next.push_back(neighbor_index);
+                            }
+                            break;
+                        }
+                    }
+                });
+            });
+        }
+
+        /*Cada raiz alcança para trás, dentro da sua cor, exatamente a sua componente*/
+        frontier.clear();
+        for (int index : active) {
+            if (color[index].load(std::memory_order_relaxed) == index) {
+                component[index].store(next_id.fetch_add(1, std::memory_order_relaxed), std::memory_order_relaxed);
+                frontier.push_back(index);
+            }
+        }
+        while (!frontier.empty()) {
+            frontier = expand(frontier, [&](int current, std::vector<int>& next) {
+                int current_color = color[current].load(std::memory_order_relaxed);
+                int id = component[current].load(std::memory_order_relaxed);
+                visit_in_neighbors(current, [&](int source_index) {
+                    int expected = -1;
+                    if (color[source_index].load(std::memory_order_relaxed) == current_color
+                        && component[source_index].compare_exchange_strong(expected, id)) {
+                        next.push_back(source_index);
+                    }
+                    return true;
+                });
+            });
+        }
+        compact_active();
+        return true;
+    }
+
+    /**
+     * @brief Resolve os nós ativos restantes com Tarjan, restrito a eles.
+     */
+    void finish_serial() {
+        if (active.empty()) {
+            return;
+        }
+        TarjanState state(order);
+        auto include = [this](int index) { return is_active(index); };
+        auto emit = [this](auto begin, auto end) {
+            int id = next_id.fetch_add(1, std::memory_order_relaxed);
+            for (auto it = begin; it != end; ++it) {
+                component[*it].store(id, std::memory_order_relaxed);
+            }
+        };
+        for (int root : active) {
+            if (state.discovery[root] == 0) {
+                tarjan_visit(graph, root, state, include, emit);
+            }
+        }
+        active.clear();
+    }
+
+public:
+    /**
+     * @brief Prepara a busca, calculando os graus e, se necessário, os arcos de entrada.
+     * @param graph O grafo a ser analisado.
+     * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+     */
+    explicit ParallelSCC(const IGraph<Node>& graph, unsigned num_threads = 0)
+        : graph(graph),
+          thread_count(num_threads == 0 ? std::max(1u, std::thread::hardware_concurrency()) : num_threads),
+          order(graph.get_order()),
+          component(new std::atomic<int>[graph.get_order()]),
+          color(new std::atomic<int>[graph.get_order()]),
+          active_in(new std::atomic<int>[graph.get_order()]),
+          active_out(new std::atomic<int>[graph.get_order()]),
+          marks(new std::atomic<uint8_t>[graph.get_order()]) {
+        out_degree.assign(order, 0);
+        in_degree.assign(order, 0);
+        int64_t arc_count = 0;
+        for (size_t i = 0; i < order; ++i) {
+            graph.for_each_neighbor(i, [&](int neighbor_index) {
+                out_degree[i]++;
+                in_degree[neighbor_index]++;
+            });
+            arc_count += out_degree[i];
+        }
+
+        own_in_arcs = !graph.has_in_neighbor_access();
+        if (own_in_arcs) {
+            in_offsets.assign(order + 1, 0);
+            for (size_t i = 0; i < order; ++i) {
+                in_offsets[i + 1] = in_offsets[i] + static_cast<size_t>(in_degree[i]);
+            }
+            std::vector<size_t> next_slot(in_offsets.begin(), in_offsets.end() - 1);
+            in_sources.resize(static_cast<size_t>(arc_count));
+            for (size_t i = 0; i < order; ++i) {
+                graph.for_each_neighbor(i, [&](int neighbor_index) {
+                    in_sources[next_slot[neighbor_index]++] = static_cast<int>(i);
+                });
+            }
+        }
+    }
+
+    /**
+     * @brief Calcula a componente fortemente conexa de cada nó.
+     * @return O identificador da componente de cada nó, na ordem do menor índice de cada
+     * componente, e o tamanho de cada componente.
+     */
+    ComponentLabels run() {
+        next_id.store(0, std::memory_order_relaxed);
+        active.resize(order);
+        for (size_t i = 0; i < order; ++i) {
+            component[i].store(-1, std::memory_order_relaxed);
+            marks[i].store(0, std::memory_order_relaxed);
+            active[i] = static_cast<int>(i);
+        }
+
+        trim();
+        if (!active.empty()) {
+            forward_backward();
+        }
+        while (!active.empty()) {
+            trim();
+            if (active.size() < SERIAL_CUTOFF) {
+                break;
+            }
+            size_t before = active.size();
+            if (!coloring_round() || (before - active.size()) * COLORING_MIN_PROGRESS < before) {
+                break;
+            }
+        }
+        finish_serial();
+
+        /*Renumera as componentes pela ordem do menor índice, independente do escalonamento*/
+        ComponentLabels result;
+        std::vector<int> renumber(next_id.load(std::memory_order_relaxed), -1);
+        result.component.resize(order);
+        for (size_t i = 0; i < order; ++i) {
+            int& id = renumber[component[i].load(std::memory_order_relaxed)];
+            if (id == -1) {
+                id = static_cast<int>(result.sizes.size());
+                result.sizes.push_back(0);
+            }
+            result.component[i] = id;
+            result.sizes[id]++;
+        }
+        return result;
+    }
+};
+
+/**
+ * @brief Calcula as componentes fortemente conexas com várias threads.
+ * @param graph O grafo a ser analisado.
+ * @param num_threads O número de threads; 0 usa o número de núcleos disponíveis.
+ * @return O identificador da componente de cada nó e o tamanho de cada componente.
+ */
+template<typename Node>
+ComponentLabels parallel_scc(const IGraph<Node>& graph, unsigned num_threads = 0) {
+    return ParallelSCC<Node>(graph, num_threads).run();
+}
+
+/**
+ * @brief Acumula o grafo condensado: um nó por componente e um arco entre duas componentes
+ * sempre que algum arco do grafo liga nós delas.
+ *
+ * Os nós do grafo condensado são os identificadores das componentes, e os arcos repetidos são
+ * descartados. Para obtê-lo em outra representação, por exemplo em um
+ * DirectedAdjacencyListGraph<int>, basta chamar build no construtor devolvido.
+ * @param graph O grafo original.
+ * @param scc As componentes do grafo, de tarjan_scc ou parallel_scc.
+ * @return Um GraphBuilder direcionado com as componentes e os arcos entre elas.
+ */
+template<typename Node>
+GraphBuilder<int> condensation_builder(const IGraph<Node>& graph, const ComponentLabels& scc) {
+    GraphBuilder<int> builder(true);
+    for (size_t id = 0; id < scc.count(); id++) {
+        builder.add_node(static_cast<int>(id));
+    }
+    for (size_t i = 0; i < graph.get_order(); i++) {
+        int from = scc.component[i];
+        graph.for_each_neighbor(i, [&](int neighbor_index) {
+            int to = scc.component[neighbor_index];
+            if (from != to) {
+                builder.add_edge_indices(from, to);
+            }
+        });
+    }
+    return builder;
+}
+
+/**
+ * @brief Monta o grafo condensado, que é acíclico, em formato CSR.
+ * @param graph O grafo original.
+ * @param scc As componentes do grafo, de tarjan_scc ou parallel_scc.
+ * @return Um grafo com um nó por componente, identificado pelo número da componente.
+ */
+template<typename Node>
+CompressedSparseRowGraph<int> condensation(const IGraph<Node>& graph, const ComponentLabels& scc) {
+    return CompressedSparseRowGraph<int>(condensation_builder(graph, scc));
+}
+
+#endif // STRONGLY_CONNECTED_COMPONENTS_H